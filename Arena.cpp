@@ -0,0 +1,41 @@
+#include "Arena.h"
+#include <iostream>
+
+CountingResource::CountingResource(std::pmr::memory_resource* upstream) : upstream(upstream) {}
+
+void* CountingResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    counters.allocations++;
+    counters.bytes += bytes;
+    return upstream->allocate(bytes, alignment);
+}
+
+void CountingResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+    counters.deallocations++;
+    upstream->deallocate(p, bytes, alignment);
+}
+
+bool CountingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+RunArena::RunArena(std::size_t initialBytes)
+    : heapCounter(std::pmr::new_delete_resource()),
+      monotonic(initialBytes, &heapCounter),
+      pool(&monotonic),
+      arenaCounter(&pool) {}
+
+void RunArena::report(const std::string& stage) const {
+    std::cout << stage << ": " << arenaStats().allocations << " allocations ("
+              << arenaStats().bytes << " bytes) served from " << heapStats().allocations
+              << " heap blocks (" << heapStats().bytes << " bytes)." << std::endl;
+}
+
+ScratchPool::ScratchPool(std::pmr::memory_resource* mr) : buffers(mr) {}
+
+std::pmr::vector<char>& ScratchPool::flags(int slot, std::size_t n) {
+    if (slot >= static_cast<int>(buffers.size())) {
+        buffers.resize(slot + 1);
+    }
+    buffers[slot].assign(n, 0); // Reuses the existing capacity after the first call
+    return buffers[slot];
+}
@@ -0,0 +1,66 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <memory_resource>
+#include <vector>
+#include <deque>
+#include <string>
+#include <cstddef>
+
+// Allocation counters collected by a CountingResource
+struct AllocationStats {
+    std::size_t allocations = 0;   // Number of allocate() calls
+    std::size_t deallocations = 0; // Number of deallocate() calls
+    std::size_t bytes = 0;         // Total bytes requested
+};
+
+// Memory resource that forwards to an upstream resource and counts the traffic
+class CountingResource : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream);
+    const AllocationStats& stats() const { return counters; }
+
+private:
+    std::pmr::memory_resource* upstream;
+    AllocationStats counters;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+// Per-run arena: a monotonic buffer that grabs large blocks from the heap, with a
+// pool on top so that memory freed mid-run (e.g. adjacency nodes removed while
+// walking an Euler tour) is recycled. Everything is returned to the heap at once
+// when the arena is destroyed.
+class RunArena {
+public:
+    explicit RunArena(std::size_t initialBytes = 1 << 20);
+    RunArena(const RunArena&) = delete;
+    RunArena& operator=(const RunArena&) = delete;
+
+    std::pmr::memory_resource* resource() { return &arenaCounter; }
+    const AllocationStats& arenaStats() const { return arenaCounter.stats(); } // Requests served by the arena
+    const AllocationStats& heapStats() const { return heapCounter.stats(); }   // Blocks taken from the heap
+    void report(const std::string& stage) const; // Print allocation counts to stdout
+
+private:
+    CountingResource heapCounter;
+    std::pmr::monotonic_buffer_resource monotonic;
+    std::pmr::unsynchronized_pool_resource pool;
+    CountingResource arenaCounter;
+};
+
+// Reusable scratch buffers handed out to algorithm stages, so repeated calls
+// (e.g. the bridge test in Fleury's algorithm) do not allocate per call
+class ScratchPool {
+public:
+    explicit ScratchPool(std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+    std::pmr::vector<char>& flags(int slot, std::size_t n); // Zeroed byte buffer of size n
+
+private:
+    // A deque, so growing it for a new slot never moves the buffers already handed out
+    std::pmr::deque<std::pmr::vector<char>> buffers;
+};
+
+#endif // ARENA_H
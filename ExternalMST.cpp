@@ -0,0 +1,226 @@
+#include "ExternalMST.h"
+#include "Graph.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <queue>
+#include <memory>
+#include <tuple>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+// On-disk edge record, ordered exactly like the (weight, u, v) tuples sorted by Graph::kruskalMST
+struct EdgeRecord {
+    float w;
+    int u;
+    int v;
+    bool operator<(const EdgeRecord& other) const {
+        return std::tie(w, u, v) < std::tie(other.w, other.u, other.v);
+    }
+};
+
+static const std::size_t minMergeRecords = 1024; // Smallest per-run buffer used while merging
+
+// Run files are the only copy of the edges, so any I/O error on them aborts the run
+static void runFileError(const std::string& action, const std::string& path) {
+    std::cerr << "Cannot " << action << " run file " << path << std::endl;
+    exit(104);
+}
+
+// Sequential reader over a sorted run file through a fixed-size buffer
+class RunReader {
+public:
+    RunReader(const std::string& path, std::size_t bufferRecords)
+        : path(path), in(path, std::ios::binary), buffer(bufferRecords), pos(0), len(0) {
+        if (!in) runFileError("open", path);
+    }
+
+    bool next(EdgeRecord& edge) {
+        if (pos == len) {
+            in.read(reinterpret_cast<char*>(buffer.data()), buffer.size() * sizeof(EdgeRecord));
+            // A short read is only fine at the end of the file and on a record boundary
+            if (in.bad() || in.gcount() % sizeof(EdgeRecord) != 0) runFileError("read", path);
+            len = static_cast<std::size_t>(in.gcount()) / sizeof(EdgeRecord);
+            pos = 0;
+            if (len == 0) return false;
+        }
+        edge = buffer[pos++];
+        return true;
+    }
+
+private:
+    std::string path;
+    std::ifstream in;
+    std::vector<EdgeRecord> buffer;
+    std::size_t pos, len;
+};
+
+// Append records to an open run file
+static void writeRecords(std::ofstream& out, const std::vector<EdgeRecord>& records, const std::string& path) {
+    out.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(EdgeRecord));
+    if (!out) runFileError("write", path);
+}
+
+// Flush and close a run file; only after this succeeds may its inputs be deleted
+static void closeRun(std::ofstream& out, const std::string& path) {
+    out.close();
+    if (!out) runFileError("write", path);
+}
+
+// Sort a buffer of edges and write it to disk as a new run
+static void writeRun(std::vector<EdgeRecord>& buffer, const std::string& path) {
+    std::sort(buffer.begin(), buffer.end());
+    std::ofstream out(path, std::ios::binary);
+    if (!out) runFileError("create", path);
+    writeRecords(out, buffer, path);
+    closeRun(out, path);
+    buffer.clear();
+}
+
+// K-way merge of sorted runs; sink(edge) is called in sorted order until it returns false
+template <class Sink>
+static void mergeRuns(const std::vector<std::string>& runs, std::size_t bufferRecords, Sink sink) {
+    std::vector<std::unique_ptr<RunReader>> readers;
+    using Entry = std::pair<EdgeRecord, std::size_t>;
+    auto later = [](const Entry& a, const Entry& b) { return b.first < a.first; };
+    std::priority_queue<Entry, std::vector<Entry>, decltype(later)> heap(later);
+
+    for (std::size_t i = 0; i < runs.size(); ++i) {
+        readers.push_back(std::make_unique<RunReader>(runs[i], bufferRecords));
+        EdgeRecord edge;
+        if (readers[i]->next(edge)) heap.push({ edge, i });
+    }
+    while (!heap.empty()) {
+        Entry top = heap.top();
+        heap.pop();
+        if (!sink(top.first)) return;
+        EdgeRecord edge;
+        if (readers[top.second]->next(edge)) heap.push({ edge, top.second });
+    }
+}
+
+void externalKruskalMST(const std::string& inputFile, const std::string& outputPath, std::size_t memoryBudget) {
+    std::ifstream inFile(inputFile);
+    std::string line;
+    if (!inFile) {
+        std::cerr << "Cannot open graph file" << inputFile << std::endl;
+        exit(101);
+    }
+    std::getline(inFile, line);
+    std::istringstream iss(line);
+    int V;
+    long long E;
+    if (!(iss >> V >> E)) {
+        std::cerr << "External Kruskal needs a Type 1 (edge list) input file." << std::endl;
+        exit(102);
+    }
+
+    // Union-find (parent + rank) and the MST edges stay in memory; everything else is buffers
+    std::size_t fixed = static_cast<std::size_t>(V) * (2 * sizeof(int) + sizeof(EdgeRecord));
+    if (memoryBudget < fixed + 3 * minMergeRecords * sizeof(EdgeRecord)) {
+        std::cerr << "Memory budget too small: at least " << fixed + 3 * minMergeRecords * sizeof(EdgeRecord)
+                  << " bytes are needed for " << V << " vertices." << std::endl;
+        exit(103);
+    }
+    std::size_t availableRecords = (memoryBudget - fixed) / sizeof(EdgeRecord);
+    int runCount = 0;
+    auto runName = [&]() { return outputPath + ".run" + std::to_string(runCount++); };
+
+    // Pass 1: stream the edge file into sorted runs of availableRecords edges each
+    std::vector<std::string> runs;
+    {
+        std::vector<EdgeRecord> buffer;
+        buffer.reserve(std::min<long long>(E, static_cast<long long>(availableRecords)));
+        int u, v;
+        float w;
+        for (long long i = 0; i < E; ++i) {
+            if (!std::getline(inFile, line)) {
+                std::cerr << "Error reading edge data, line " << i + 1 << "." << std::endl;
+                exit(102);
+            }
+            std::istringstream edgeStream(line);
+            if (!(edgeStream >> u >> v >> w)) {
+                std::cerr << "Error processing edge data on line " << i + 1 << "." << std::endl;
+                exit(102);
+            }
+            buffer.push_back({ w, u, v });
+            if (buffer.size() == availableRecords) {
+                runs.push_back(runName());
+                writeRun(buffer, runs.back());
+            }
+        }
+        if (!buffer.empty()) {
+            runs.push_back(runName());
+            writeRun(buffer, runs.back());
+        }
+    }
+    std::size_t initialRuns = runs.size();
+
+    // Intermediate passes: merge groups of fanIn runs (fanIn input buffers + 1 output buffer)
+    std::size_t fanIn = std::max<std::size_t>(2, availableRecords / minMergeRecords - 1);
+    int passes = 0;
+    while (runs.size() > fanIn) {
+        std::size_t bufferRecords = availableRecords / (fanIn + 1);
+        std::vector<std::string> merged;
+        for (std::size_t first = 0; first < runs.size(); first += fanIn) {
+            std::vector<std::string> group(runs.begin() + first, runs.begin() + std::min(runs.size(), first + fanIn));
+            merged.push_back(runName());
+            std::ofstream out(merged.back(), std::ios::binary);
+            if (!out) runFileError("create", merged.back());
+            std::vector<EdgeRecord> outBuffer;
+            outBuffer.reserve(bufferRecords);
+            mergeRuns(group, bufferRecords, [&](const EdgeRecord& edge) {
+                outBuffer.push_back(edge);
+                if (outBuffer.size() == bufferRecords) {
+                    writeRecords(out, outBuffer, merged.back());
+                    outBuffer.clear();
+                }
+                return true;
+            });
+            writeRecords(out, outBuffer, merged.back());
+            closeRun(out, merged.back());
+            for (const auto& run : group) std::remove(run.c_str()); // Safe: the merged run is complete
+        }
+        runs.swap(merged);
+        passes++;
+    }
+
+    // Final pass: merged edges feed the union-find directly; stop once the tree is complete
+    std::vector<int> parent(V);
+    std::vector<int> rank(V, 0);
+    for (int v = 0; v < V; ++v) parent[v] = v;
+    std::vector<EdgeRecord> mst;
+    mst.reserve(V > 0 ? V - 1 : 0);
+    if (!runs.empty()) {
+        mergeRuns(runs, availableRecords / runs.size(), [&](const EdgeRecord& edge) {
+            if (Graph::find(parent, edge.u) != Graph::find(parent, edge.v)) {
+                mst.push_back(edge);
+                Graph::unionSet(parent, rank, edge.u, edge.v);
+            }
+            return static_cast<int>(mst.size()) < V - 1;
+        });
+    }
+    passes++;
+    for (const auto& run : runs) std::remove(run.c_str());
+
+    // Write to output file
+    std::ofstream outFile(outputPath);
+    if (!outFile) {
+        std::cerr << "Cannot open output file." << std::endl;
+        exit(104);
+    }
+    outFile << V << " " << mst.size() << std::endl;
+    for (const auto& edge : mst) {
+        outFile << edge.u << " " << edge.v << " " << edge.w << std::endl;
+    }
+    outFile.close();
+    if (!outFile) {
+        std::cerr << "Error writing output file " << outputPath << std::endl;
+        exit(104);
+    }
+
+    std::cout << "External Kruskal: " << E << " edges, " << initialRuns << " sorted runs, " << passes
+              << " merge passes within a " << memoryBudget << " byte budget." << std::endl;
+}
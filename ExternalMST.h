@@ -0,0 +1,14 @@
+#ifndef EXTERNAL_MST_H
+#define EXTERNAL_MST_H
+
+#include <string>
+#include <cstddef>
+
+// Kruskal's algorithm for Type 1 edge files larger than memory. The edge file is streamed into
+// sorted runs on disk, the runs are k-way merged (in several passes if needed) and the merged
+// stream feeds the union-find directly. Buffers are sized so that peak memory stays within
+// memoryBudget bytes (the union-find and MST edges, 20 bytes per vertex, count against it).
+// Writes the same MST file as Graph::kruskalMST.
+void externalKruskalMST(const std::string& inputFile, const std::string& outputPath, std::size_t memoryBudget);
+
+#endif // EXTERNAL_MST_H
@@ -1,10 +1,15 @@
 #include "Graph.h"
+#include "Tour.h"
+#include "TSPLIB.h"
 #include <fstream>
 #include <stack>
 #include <iostream>
 #include <sstream>
+#include <cmath>
+#include <cfloat>
 
-Graph::Graph(int V, int E) : V(V), E(E), adj(V), adjMatrix(V, std::vector<float>(V, 0)) {
+Graph::Graph(int V, int E, std::pmr::memory_resource* mr)
+    : V(V), E(E), adj(V, mr), edges(mr), adjMatrix(V, std::pmr::vector<float>(V, 0, mr), mr), scratch(mr) {
     edges.reserve(E);
 }
 
@@ -50,7 +55,7 @@ void Graph::printEulerTour(const std::string& outputFilePath) {
     while (!stack.empty()) {
         int u = stack.top();
         stack.pop();
-        std::list<std::pair<int, float>> temp(adj[u].begin(), adj[u].end());
+        std::pmr::list<std::pair<int, float>> temp(adj[u].begin(), adj[u].end(), adj[u].get_allocator());
 
         if (!temp.empty()) {
             for (auto it = temp.begin(); it != temp.end(); ++it) {
@@ -73,17 +78,16 @@ void Graph::printEulerTour(const std::string& outputFilePath) {
 }
 
 bool Graph::isValidNextEdge(int u, int v, float w) {
-    std::vector<char> visited(V, 0);
-    int count1 = DFSCount(u, visited);
+    int count1 = DFSCount(u, scratch.flags(0, V));
     removeEdge(u, v, w);
-    std::vector<char> visited2(V, 0);
-    int count2 = DFSCount(u, visited2);
-    addEdge(u, v, w); // Revert changes
+    int count2 = DFSCount(u, scratch.flags(1, V));
+    adj[u].push_back({ v, w }); // Revert changes (the edge list and matrix were not touched)
+    adj[v].push_back({ u, w });
 
     return count1 == count2;
 }
 
-int Graph::DFSCount(int v, std::vector<char>& visited) {
+int Graph::DFSCount(int v, std::pmr::vector<char>& visited) {
     visited[v] = 1;
     int count = 1;
     for (std::pair<int, int> adjacent : adj[v]) {
@@ -174,7 +178,7 @@ int Graph::minKey(std::vector<float>& key, std::vector<bool>& mstSet) {
 }
 
 void Graph::primMST(const std::string& outputPath) {
-    std::vector<int> parent(V); // Array to store constructed MST
+    std::vector<int> parent(V, -1); // Array to store constructed MST
     std::vector<float> key(V, FLT_MAX); // Key values used to pick minimum weight edge in cut
     std::vector<bool> mstSet(V, false); // To represent set of vertices not yet included in MST
 
@@ -183,6 +187,7 @@ void Graph::primMST(const std::string& outputPath) {
 
     for (int count = 0; count < V - 1; count++) {
         int u = minKey(key, mstSet);
+        if (u < 0) break; // The rest is unreachable (e.g. isolated vertices); keep the spanning forest
         mstSet[u] = true;
 
         for (int v = 0; v < V; v++)
@@ -197,47 +202,29 @@ void Graph::primMST(const std::string& outputPath) {
         return;
     }
 
-    // Writing number of vertices and number of edges in MST, which is V-1
-    outFile << V << " " << V - 1 << std::endl;
+    // Writing number of vertices and number of edges in MST, which is V-1 for a connected graph
+    int treeEdges = static_cast<int>(std::count_if(parent.begin(), parent.end(), [](int p) { return p >= 0; }));
+    outFile << V << " " << treeEdges << std::endl;
 
     for (int i = 1; i < V; i++)
-        outFile << parent[i] << " " << i << " " << adjMatrix[i][parent[i]] << "\n";
+        if (parent[i] >= 0)
+            outFile << parent[i] << " " << i << " " << adjMatrix[i][parent[i]] << "\n";
     outFile.close();
 }
 
-void Graph::constructHamiltonianCycle(const std::string& outputPath) {
-    std::vector<int> cycle = { 0 }; // Starting with vertex 0
-    std::vector<bool> inCycle(V, false);
-    inCycle[0] = true;
-
-    for (int i = 1; i < V; i++) {
-        int closest = -1, minDist = FLT_MAX;
-        for (int j = 0; j < V; j++) {
-            if (!inCycle[j] && adjMatrix[cycle.back()][j] < minDist) {
-                closest = j;
-                minDist = adjMatrix[cycle.back()][j];
-            }
-        }
-        cycle.push_back(closest);
-        inCycle[closest] = true;
-    }
-    cycle.push_back(cycle.front()); // Make it a cycle by connecting back to the start
-
-    std::ofstream outFile(outputPath);
-    if (!outFile) {
-        std::cerr << "Could not open file for writing." << std::endl;
-        exit(1);
-    }
-
-    outFile << V << " " << V << std::endl;
-
-    for (size_t i = 0; i < cycle.size() - 1; i++) {
-        int u = cycle[i];
-        int v = cycle[i + 1];
-        float weight = adjMatrix[u][v]; // Accessing the weight of the edge
-        outFile << u << " " << v << " " << weight << std::endl;
+void Graph::constructHamiltonianCycle(const std::string& outputPath, int starts, int randomizedRuns) {
+    MatrixDistance dist(*this);
+    MultiStartResult best = nearestNeighborMultiStart(dist, starts, randomizedRuns);
+    writeCycle(best.cycle, dist, V, outputPath);
+
+    if (best.runs.size() > 1) {
+        int pruned = 0;
+        for (const auto& run : best.runs) pruned += run.pruned;
+        const StartStats& winner = best.runs[best.bestRun];
+        std::cout << "Nearest neighbor: " << best.runs.size() << " runs, " << pruned << " pruned early; best tour "
+                  << best.length << " from vertex " << winner.start << (winner.randomized ? " (randomized)" : "")
+                  << ", vertex 0 gave " << best.runs[0].length << (best.runs[0].pruned ? " (pruned)" : "") << "." << std::endl;
     }
-    outFile.close();
 }
 
 void Graph::duplicateEdgesInMST(const std::string& mstOutputFile, const std::string& duplicatedEdgesFile) {
@@ -269,48 +256,28 @@ void Graph::duplicateEdgesInMST(const std::string& mstOutputFile, const std::str
     }
 }
 
-void Graph::convertToHamiltonianCycle(Graph g, const std::string& outputPath) {
-    std::unordered_set<int> visited;
-    std::vector<int> hamiltonianCycle;
-    std::vector<float> cycleWeight;
-    std::ofstream outFile(outputPath);
-
-    // Write the number of vertices and number of edges (equal to the number of vertices in Hamiltonian cycle) to the new file
-    outFile << V << " " << V << std::endl;
-
-    int count = 0;
+void Graph::convertToHamiltonianCycle(const Graph& g, const std::string& outputPath, int maxStarts) {
+    // The edges of this graph are the Euler tour in walk order: u0 v0, v0 v1, ...
+    std::vector<int> walk;
+    walk.reserve(edges.size() + 1);
     for (const auto& edge : edges) {
-        if (count == 0) {
-            visited.insert(std::get<1>(edge));
-            hamiltonianCycle.push_back(std::get<1>(edge));
-            visited.insert(std::get<2>(edge));
-            hamiltonianCycle.push_back(std::get<2>(edge));
-            cycleWeight.push_back(g.adjMatrix[hamiltonianCycle[hamiltonianCycle.size() - 2]][hamiltonianCycle[hamiltonianCycle.size() - 1]]);
-        }
-        else if (visited.insert(std::get<2>(edge)).second) { // Successfully inserted means not visited before
-            hamiltonianCycle.push_back(std::get<2>(edge));
-            cycleWeight.push_back(g.adjMatrix[hamiltonianCycle[hamiltonianCycle.size() - 2]][hamiltonianCycle[hamiltonianCycle.size() - 1]]);
-        }
-        count++;
+        if (walk.empty()) walk.push_back(std::get<1>(edge));
+        walk.push_back(std::get<2>(edge));
     }
-    hamiltonianCycle.push_back(hamiltonianCycle.front()); // Closing the cycle
-    cycleWeight.push_back(g.adjMatrix[hamiltonianCycle[hamiltonianCycle.size() - 2]][hamiltonianCycle[hamiltonianCycle.size() - 1]]);
 
-    for (size_t i = 0; i < hamiltonianCycle.size() - 1; ++i) {
-        outFile << hamiltonianCycle[i] << " " << hamiltonianCycle[i + 1] << " " << cycleWeight[i] << '\n';
-    }
+    MatrixDistance dist(g);
+    ShortcutResult best = shortcutEulerTour(walk, V, dist, maxStarts);
+    writeCycle(best.cycle, dist, V, outputPath);
+
+    std::cout << "Shortcutting: best of " << best.evaluated << " Euler tour starts/orientations has length "
+              << best.length << " (fixed order gave " << best.firstLength << ")." << std::endl;
 }
 
 std::vector<int> Graph::findOddDegreeVertices() {
-    std::unordered_map<int, int> degreeCount;
-    for (int i = 0; i < V; ++i) {
-        degreeCount[i] = adj[i].size();
-    }
-
     std::vector<int> oddVertices;
-    for (const auto& vertex : degreeCount) {
-        if (vertex.second % 2 != 0) { // If degree is odd
-            oddVertices.push_back(vertex.first);
+    for (int i = 0; i < V; ++i) {
+        if (adj[i].size() % 2 != 0) { // If degree is odd
+            oddVertices.push_back(i);
         }
     }
     return oddVertices;
@@ -318,11 +285,12 @@ std::vector<int> Graph::findOddDegreeVertices() {
 
 void Graph::prepareMWPMInput(const std::vector<int>& oddVertices, const std::string& mwpmInputPath, std::unordered_map<int, int>& vertexMap) {
     std::ofstream mwpmInputFile(mwpmInputPath);
-    std::unordered_set<int> oddVerticesSet(oddVertices.begin(), oddVertices.end());
-    std::vector<std::tuple<float, int, int>> filteredEdges;
+    std::pmr::vector<char>& isOdd = scratch.flags(0, V);
+    for (int v : oddVertices) isOdd[v] = 1;
+    std::pmr::vector<std::tuple<float, int, int>> filteredEdges(edges.get_allocator());
 
     for (const auto& edge : edges) {
-        if (oddVerticesSet.count(std::get<1>(edge)) && oddVerticesSet.count(std::get<2>(edge))) {
+        if (isOdd[std::get<1>(edge)] && isOdd[std::get<2>(edge)]) {
             filteredEdges.emplace_back(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
         }
     }
@@ -342,13 +310,16 @@ void Graph::saveGraphToFile(const std::string& filePath) {
     }
 }
 
-Graph create_graph(const std::string& inputFile) {
+Graph create_graph(const std::string& inputFile, std::pmr::memory_resource* mr) {
     std::ifstream inFile(inputFile);
     std::string line;
     if (!inFile) {
         std::cerr << "Cannot open graph file" << inputFile << std::endl;
         exit(101);
     }
+    if (isTSPLIBFile(inputFile)) {
+        return tsplibGraph(readTSPLIB(inputFile), mr);
+    }
 
     // Read the first line to determine the format
     std::getline(inFile, line);
@@ -356,7 +327,7 @@ Graph create_graph(const std::string& inputFile) {
     int V, E;
 
     if (iss >> V >> E) {  // Reading the format with specified vertices and edges
-        Graph g(V, E);
+        Graph g(V, E, mr);
         int u, v;
         float w;
         for (int i = 0; i < E; ++i) {
@@ -374,29 +345,46 @@ Graph create_graph(const std::string& inputFile) {
         return g;
     }
     else {  // Reading the format with only vertices and their coordinates
-        Graph g(V, V * (V - 1) / 2);  // Assuming a complete graph
-        std::vector<std::pair<float, float>> vertices(V);
-        float x, y;
-        for (int i = 0; i < V; ++i) {
-            if (!std::getline(inFile, line)) {
-                std::cerr << "Error reading coordinate data on line " << i + 1 << "." << std::endl;
-                exit(102);
-            }
-            std::istringstream coordStream(line);
-            if (!(coordStream >> x >> y)) {
-                std::cerr << "Error processing coordinates on line " << i + 1 << "." << std::endl;
-                exit(102);
-            }
-            vertices[i] = { x, y };
-        }
+        std::vector<std::pair<float, float>> vertices = readCoordinates(inputFile);
+        V = static_cast<int>(vertices.size());
+        Graph g(V, V * (V - 1) / 2, mr);  // Assuming a complete graph
 
         // Calculate distances and add edges
         for (int i = 0; i < V; ++i) {
             for (int j = i + 1; j < V; ++j) {
-                float dist = std::sqrt(std::pow(vertices[j].first - vertices[i].first, 2) + std::pow(vertices[j].second - vertices[i].second, 2));
-                g.addEdge(i, j, dist);
+                g.addEdge(i, j, Euclidean::distance(vertices[i], vertices[j]));
             }
         }
         return g;
     }
+}
+
+std::vector<std::pair<float, float>> readCoordinates(const std::string& inputFile) {
+    std::ifstream inFile(inputFile);
+    std::string line;
+    if (!inFile) {
+        std::cerr << "Cannot open coordinate file" << inputFile << std::endl;
+        exit(101);
+    }
+
+    int V = 0;
+    std::getline(inFile, line);
+    std::istringstream iss(line);
+    iss >> V;
+
+    std::vector<std::pair<float, float>> vertices(V);
+    float x, y;
+    for (int i = 0; i < V; ++i) {
+        if (!std::getline(inFile, line)) {
+            std::cerr << "Error reading coordinate data on line " << i + 1 << "." << std::endl;
+            exit(102);
+        }
+        std::istringstream coordStream(line);
+        if (!(coordStream >> x >> y)) {
+            std::cerr << "Error processing coordinates on line " << i + 1 << "." << std::endl;
+            exit(102);
+        }
+        vertices[i] = { x, y };
+    }
+    return vertices;
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <list>
+#include <memory_resource>
 #include <tuple>
 #include <unordered_set>
 #include <unordered_map>
@@ -10,46 +11,49 @@
 #include <climits>
 #include <cstdlib>
 #include <algorithm>
+#include "Arena.h"
 
 class Graph {
 public:
     int V;    // Number of vertices
     int E;    // Number of edges
-    std::vector < std::list<std::pair<int, float>>> adj; // Adjacency list
-    std::vector<std::tuple<float, int, int>> edges; // Edge list
-    std::vector<std::vector<float>> adjMatrix; // Adjacency matrix
+    std::pmr::vector<std::pmr::list<std::pair<int, float>>> adj; // Adjacency list
+    std::pmr::vector<std::tuple<float, int, int>> edges; // Edge list
+    std::pmr::vector<std::pmr::vector<float>> adjMatrix; // Adjacency matrix
+    ScratchPool scratch; // Reusable visited/flag buffers
 
-    Graph(int V, int E);  // Constructor
+    Graph(int V, int E, std::pmr::memory_resource* mr = std::pmr::get_default_resource());  // Constructor
     void addEdge(int u, int v, float w); // Function to add an edge
     void removeEdge(int u, int v, float w); // Function to remove edge
     void saveGraphToFile(const std::string& filePath); // Save graph
 
     // Algorithm 1 
     void printEulerTour(const std::string& outputFilePath);
-    int DFSCount(int v, std::vector<char>& visited);
+    int DFSCount(int v, std::pmr::vector<char>& visited);
     bool isValidNextEdge(int u, int v, float w);
 
     // Algorithm 2
     void kruskalMST(const std::string& outputPath);
-    int find(std::vector<int>& parent, int i); // Find with path compression
-    void unionSet(std::vector<int>& parent, std::vector<int>& rank, int u, int v); // Union by rank
+    static int find(std::vector<int>& parent, int i); // Find with path compression
+    static void unionSet(std::vector<int>& parent, std::vector<int>& rank, int u, int v); // Union by rank
 
     // Algorithm 3
     void primMST(const std::string& outputPath);
     int minKey(std::vector<float>& key, std::vector<bool>& mstSet);
 
     // Algorithm 4
-    void constructHamiltonianCycle(const std::string& outputPath);
+    void constructHamiltonianCycle(const std::string& outputPath, int starts = 1, int randomizedRuns = 0); // Multi-start nearest neighbor
 
     // Algorithm 5
     void duplicateEdgesInMST(const std::string& mstOutputFile, const std::string& duplicatedEdgesFile);
-    void convertToHamiltonianCycle(Graph g, const std::string& outputPath);
+    void convertToHamiltonianCycle(const Graph& g, const std::string& outputPath, int maxStarts = 64); // Shortcut this Euler tour using g's distances
 
     // Algorithm 6
     std::vector<int> findOddDegreeVertices();
     void prepareMWPMInput(const std::vector<int>& oddVertices, const std::string& mwpmInputPath, std::unordered_map<int, int>& vertexMap);
 };
 
-Graph create_graph(const std::string& inputFile);
+Graph create_graph(const std::string& inputFile, std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+std::vector<std::pair<float, float>> readCoordinates(const std::string& inputFile); // Type 2 input only
 
 #endif // GRAPH_H
\ No newline at end of file
@@ -0,0 +1,241 @@
+#include "Incremental.h"
+#include "Graph.h"
+#include <cfloat>
+#include <numeric>
+#include <tuple>
+
+IncrementalTour::IncrementalTour(const std::vector<std::pair<float, float>>& points, double rebuildRatio)
+    : points(points), alive(points.size(), 1), aliveCount(static_cast<int>(points.size())), dist(this->points),
+      mstTotal(0), length(0), rebuildRatio(rebuildRatio), tourRebuilds(0) {
+    rebuild();
+}
+
+void IncrementalTour::rebuild() {
+    buildMST();
+    buildTour();
+}
+
+void IncrementalTour::buildMST() {
+    int n = static_cast<int>(points.size());
+    mst.assign(n, {});
+    mstTotal = 0;
+
+    // Prim on the complete graph of alive cities, O(n^2) without a distance matrix
+    std::vector<float> key(n, FLT_MAX);
+    std::vector<int> parent(n, -1);
+    std::vector<char> inTree(n, 0);
+    for (int v = 0; v < n; ++v) {
+        if (alive[v]) {
+            key[v] = 0;
+            break;
+        }
+    }
+    for (int count = 0; count < aliveCount; ++count) {
+        int u = -1;
+        for (int v = 0; v < n; ++v) {
+            if (alive[v] && !inTree[v] && (u < 0 || key[v] < key[u])) u = v;
+        }
+        if (u < 0) break;
+        inTree[u] = 1;
+        if (parent[u] >= 0) {
+            mst[u].push_back(parent[u]);
+            mst[parent[u]].push_back(u);
+            mstTotal += key[u];
+        }
+        for (int v = 0; v < n; ++v) {
+            if (alive[v] && !inTree[v]) {
+                float d = dist(u, v);
+                if (d < key[v]) {
+                    key[v] = d;
+                    parent[v] = u;
+                }
+            }
+        }
+    }
+}
+
+void IncrementalTour::buildTour() {
+    int n = static_cast<int>(points.size());
+    int root = -1;
+    for (int v = 0; v < n && root < 0; ++v) {
+        if (alive[v]) root = v;
+    }
+    tour.clear();
+    length = 0;
+    if (root < 0) return;
+
+    std::vector<int> walk = doubledTreeWalk(mst, root);
+    tour = shortcutEulerTour(walk, n, dist).cycle;
+    twoOpt(tour, dist, {}, 10 * aliveCount);
+    length = cycleLength(tour, dist);
+}
+
+void IncrementalTour::reconnectMST(const std::vector<std::tuple<float, int, int>>& candidates) {
+    int n = static_cast<int>(points.size());
+    std::vector<int> parent(n);
+    std::vector<int> rank(n, 0);
+    std::iota(parent.begin(), parent.end(), 0);
+    for (int u = 0; u < n; ++u) {
+        for (int v : mst[u]) {
+            if (u < v) Graph::unionSet(parent, rank, u, v);
+        }
+    }
+
+    std::vector<std::tuple<float, int, int>> sorted(candidates);
+    std::sort(sorted.begin(), sorted.end());
+    for (const auto& edge : sorted) {
+        int u = std::get<1>(edge), v = std::get<2>(edge);
+        if (Graph::find(parent, u) != Graph::find(parent, v)) {
+            Graph::unionSet(parent, rank, u, v);
+            mst[u].push_back(v);
+            mst[v].push_back(u);
+            mstTotal += std::get<0>(edge);
+        }
+    }
+}
+
+void IncrementalTour::checkQuality() {
+    if (mstTotal > 0 && length > rebuildRatio * mstTotal) {
+        buildTour();
+        tourRebuilds++;
+    }
+}
+
+int IncrementalTour::addVertex(float x, float y) {
+    int v = static_cast<int>(points.size());
+    points.push_back({ x, y });
+    alive.push_back(1);
+    mst.emplace_back();
+
+    // New MST is the MST of the old tree edges plus the star of the new city (cycle property)
+    std::vector<std::tuple<float, int, int>> candidates;
+    candidates.reserve(2 * aliveCount);
+    for (int u = 0; u < v; ++u) {
+        if (!alive[u]) continue;
+        for (int w : mst[u]) {
+            if (u < w) candidates.emplace_back(dist(u, w), u, w);
+        }
+        candidates.emplace_back(dist(u, v), u, v);
+    }
+    for (auto& adjacent : mst) adjacent.clear();
+    mstTotal = 0;
+    aliveCount++;
+    reconnectMST(candidates);
+
+    // Cheapest insertion into the current tour, then 2-opt around the new city
+    if (tour.size() < 2) {
+        tour.push_back(v);
+        length = cycleLength(tour, dist);
+    }
+    else {
+        size_t bestPos = 0;
+        double bestDelta = DBL_MAX;
+        for (size_t i = 0; i < tour.size(); ++i) {
+            int a = tour[i], b = tour[(i + 1) % tour.size()];
+            double delta = static_cast<double>(dist(a, v)) + dist(v, b) - dist(a, b);
+            if (delta < bestDelta) {
+                bestDelta = delta;
+                bestPos = i + 1;
+            }
+        }
+        tour.insert(tour.begin() + bestPos, v);
+        length += bestDelta;
+        length -= twoOpt(tour, dist, { v }, 50);
+    }
+    checkQuality();
+    return v;
+}
+
+bool IncrementalTour::removeVertex(int id) {
+    int n = static_cast<int>(points.size());
+    if (id < 0 || id >= n || !alive[id]) return false;
+    alive[id] = 0;
+    aliveCount--;
+
+    // Delete the city's tree edges; the tree falls apart into one component per former neighbor
+    std::vector<int> neighbors;
+    neighbors.swap(mst[id]);
+    for (int u : neighbors) {
+        mst[u].erase(std::find(mst[u].begin(), mst[u].end(), id));
+        mstTotal -= dist(u, id);
+    }
+    if (neighbors.size() > 1) {
+        int k = static_cast<int>(neighbors.size());
+        std::vector<int> comp(n, -1);
+        std::vector<std::vector<int>> members(k);
+        std::vector<int> stack;
+        for (int c = 0; c < k; ++c) {
+            comp[neighbors[c]] = c;
+            stack.push_back(neighbors[c]);
+            while (!stack.empty()) {
+                int u = stack.back();
+                stack.pop_back();
+                members[c].push_back(u);
+                for (int w : mst[u]) {
+                    if (comp[w] < 0) {
+                        comp[w] = c;
+                        stack.push_back(w);
+                    }
+                }
+            }
+        }
+
+        // Cheapest edge between every pair of components, then Kruskal over those (cut property).
+        // Every such edge has an end outside the largest component, so only the k-1 smaller
+        // components are scanned: O((n - largest) * n) instead of O(n^2).
+        int largest = 0;
+        for (int c = 1; c < k; ++c) {
+            if (members[c].size() > members[largest].size()) largest = c;
+        }
+        std::vector<std::tuple<float, int, int>> best(k * k, std::make_tuple(FLT_MAX, -1, -1));
+        for (int c = 0; c < k; ++c) {
+            if (c == largest) continue;
+            for (int u : members[c]) {
+                for (int w = 0; w < n; ++w) {
+                    int other = comp[w];
+                    // Skip dead cities, c itself, and smaller components that scan this pair themselves
+                    if (!alive[w] || other == c || (other != largest && other < c)) continue;
+                    int a = std::min(c, other), b = std::max(c, other);
+                    float d = dist(u, w);
+                    if (d < std::get<0>(best[a * k + b])) best[a * k + b] = std::make_tuple(d, u, w);
+                }
+            }
+        }
+        std::vector<std::tuple<float, int, int>> candidates;
+        for (const auto& edge : best) {
+            if (std::get<1>(edge) >= 0) candidates.push_back(edge);
+        }
+        reconnectMST(candidates);
+    }
+
+    // Splice the city out of the tour, then 2-opt around the new edge
+    auto it = std::find(tour.begin(), tour.end(), id);
+    size_t i = it - tour.begin();
+    if (tour.size() > 2) {
+        int prev = tour[(i + tour.size() - 1) % tour.size()];
+        int next = tour[(i + 1) % tour.size()];
+        length -= static_cast<double>(dist(prev, id)) + dist(id, next) - dist(prev, next);
+        tour.erase(it);
+        length -= twoOpt(tour, dist, { prev, next }, 50);
+    }
+    else {
+        tour.erase(it);
+        length = cycleLength(tour, dist);
+    }
+    checkQuality();
+    return true;
+}
+
+std::vector<std::pair<float, float>> IncrementalTour::alivePoints() const {
+    std::vector<std::pair<float, float>> result;
+    result.reserve(aliveCount);
+    for (size_t v = 0; v < points.size(); ++v) {
+        if (alive[v]) result.push_back(points[v]);
+    }
+    return result;
+}
+
+void IncrementalTour::saveTour(const std::string& outputPath) const {
+    // Ids are stable, so the header counts every id ever used; removed ids are isolated vertices
+    writeCycle(tour, dist, static_cast<int>(points.size()), static_cast<int>(tour.size()), outputPath);
+}
@@ -0,0 +1,47 @@
+#ifndef INCREMENTAL_H
+#define INCREMENTAL_H
+
+#include <vector>
+#include <string>
+#include "Tour.h"
+
+// Keeps the MST and a tour of a Type 2 (coordinate) instance in memory and repairs both when
+// cities are added or removed, instead of rebuilding from scratch.
+// Vertex ids are stable: removed ids are never reused, new cities get the next free id.
+class IncrementalTour {
+public:
+    explicit IncrementalTour(const std::vector<std::pair<float, float>>& points, double rebuildRatio = 2.0);
+    IncrementalTour(const IncrementalTour&) = delete;
+    IncrementalTour& operator=(const IncrementalTour&) = delete;
+
+    int addVertex(float x, float y);  // Insert a city, returns its id
+    bool removeVertex(int id);        // Remove a city, false if id is unknown or already removed
+    void rebuild();                   // Full recompute: Prim MST, shortcut doubled MST, 2-opt
+
+    int size() const { return aliveCount; }
+    double tourLength() const { return length; }
+    double mstWeight() const { return mstTotal; }
+    int rebuilds() const { return tourRebuilds; }
+    std::vector<std::pair<float, float>> alivePoints() const; // Coordinates of the current cities, in id order
+    void saveTour(const std::string& outputPath) const;
+
+private:
+    std::vector<std::pair<float, float>> points;
+    std::vector<char> alive;
+    int aliveCount;
+    PointDistance dist;
+
+    std::vector<std::vector<int>> mst; // MST adjacency, indexed by id
+    double mstTotal;
+    std::vector<int> tour;             // Current tour, closing edge implied
+    double length;
+    double rebuildRatio;               // Rebuild the tour from the MST if length exceeds rebuildRatio * MST weight
+    int tourRebuilds;
+
+    void buildMST();
+    void buildTour();
+    void reconnectMST(const std::vector<std::tuple<float, int, int>>& candidates);
+    void checkQuality();
+};
+
+#endif // INCREMENTAL_H
@@ -1,9 +1,10 @@
 #include "algorithm.h"
 #include <iostream>
+#include <cstdlib>
 
 int main(int argc, char* argv[]) {
     if (argc < 4) {
-        std::cerr << "Usage: " << argv[0] << " algorithm_number inputFilePath outputFilePath" << std::endl;
+        std::cerr << "Usage: " << argv[0] << " algorithm_number inputFilePath outputFilePath [options]" << std::endl;
         return 1;
     }
 
@@ -15,13 +16,18 @@ int main(int argc, char* argv[]) {
         runAlgorithm1(inputFilePath, outputFilePath);
     }
     else if (algorithmNumber == "2") {
-        runAlgorithm2(inputFilePath, outputFilePath);
+        // Optional: memory budget in MB, switches to the external-memory Kruskal
+        double memoryBudgetMB = argc > 4 ? std::atof(argv[4]) : 0;
+        runAlgorithm2(inputFilePath, outputFilePath, memoryBudgetMB);
     }
     else if (algorithmNumber == "3") {
         runAlgorithm3(inputFilePath, outputFilePath);
     }
     else if (algorithmNumber == "4") {
-        runAlgorithm4(inputFilePath, outputFilePath);
+        // Optional: number of nearest-neighbor starts and of randomized greedy runs
+        int starts = argc > 4 ? std::atoi(argv[4]) : 1;
+        int randomizedRuns = argc > 5 ? std::atoi(argv[5]) : 0;
+        runAlgorithm4(inputFilePath, outputFilePath, starts, randomizedRuns);
     }
     else if (algorithmNumber == "5") {
         runAlgorithm5(inputFilePath, outputFilePath);
@@ -30,7 +36,30 @@ int main(int argc, char* argv[]) {
         runAlgorithm6(inputFilePath, outputFilePath);
     }
     else if (algorithmNumber == "7") {
-        runAlgorithm7(inputFilePath, outputFilePath);
+        // Optional: "dna" stores the reads 2-bit packed
+        bool nucleotides = argc > 4 && std::string(argv[4]) == "dna";
+        runAlgorithm7(inputFilePath, outputFilePath, nucleotides);
+    }
+    else if (algorithmNumber == "8") {
+        if (argc < 5) {
+            std::cerr << "Usage: " << argv[0] << " 8 inputFilePath outputFilePath updatesFilePath" << std::endl;
+            return 1;
+        }
+        runAlgorithm8(inputFilePath, outputFilePath, argv[4]);
+    }
+    else if (algorithmNumber == "9") {
+        // Optional: number of nearest-neighbor starts
+        int starts = argc > 4 ? std::atoi(argv[4]) : 8;
+        runAlgorithm9(inputFilePath, outputFilePath, starts);
+    }
+    else if (algorithmNumber == "10") {
+        // Optional: maximum cities per tile and seam smoothing window (0 disables smoothing)
+        int tileSize = argc > 4 ? std::atoi(argv[4]) : 500;
+        int smoothWindow = argc > 5 ? std::atoi(argv[5]) : 100;
+        runAlgorithm10(inputFilePath, outputFilePath, tileSize, smoothWindow);
+    }
+    else if (algorithmNumber == "bench") {
+        runMetricBenchmark(inputFilePath, outputFilePath);
     }
 
     return 0;
@@ -0,0 +1,110 @@
+#ifndef METRIC_H
+#define METRIC_H
+
+#include <vector>
+#include <utility>
+#include <cmath>
+
+// Distance metric policies. Each one is a stateless struct with static, inline functions, passed as a
+// template parameter to the tour and MST code so the distance is compiled into the hot loops instead of
+// being dispatched at run time. prepare() converts a raw input coordinate once, before any distances
+// are taken (only GEO needs it). The rounding rules of the TSPLIB ones follow the TSPLIB documentation.
+
+// Plain Euclidean distance, unrounded (Type 2 input)
+struct Euclidean {
+    template <class Coord>
+    static std::pair<Coord, Coord> prepare(const std::pair<Coord, Coord>& p) { return p; }
+    template <class Coord>
+    static float distance(const std::pair<Coord, Coord>& a, const std::pair<Coord, Coord>& b) {
+        double dx = a.first - b.first;
+        double dy = a.second - b.second;
+        return static_cast<float>(std::sqrt(dx * dx + dy * dy));
+    }
+};
+
+// TSPLIB EUC_2D: Euclidean distance rounded to the nearest integer
+struct Euc2D {
+    template <class Coord>
+    static std::pair<Coord, Coord> prepare(const std::pair<Coord, Coord>& p) { return p; }
+    template <class Coord>
+    static float distance(const std::pair<Coord, Coord>& a, const std::pair<Coord, Coord>& b) {
+        double dx = a.first - b.first;
+        double dy = a.second - b.second;
+        return static_cast<float>(static_cast<int>(std::sqrt(dx * dx + dy * dy) + 0.5));
+    }
+};
+
+// TSPLIB CEIL_2D: Euclidean distance rounded up
+struct Ceil2D {
+    template <class Coord>
+    static std::pair<Coord, Coord> prepare(const std::pair<Coord, Coord>& p) { return p; }
+    template <class Coord>
+    static float distance(const std::pair<Coord, Coord>& a, const std::pair<Coord, Coord>& b) {
+        double dx = a.first - b.first;
+        double dy = a.second - b.second;
+        return static_cast<float>(std::ceil(std::sqrt(dx * dx + dy * dy)));
+    }
+};
+
+// TSPLIB ATT: pseudo-Euclidean distance
+struct Att {
+    template <class Coord>
+    static std::pair<Coord, Coord> prepare(const std::pair<Coord, Coord>& p) { return p; }
+    template <class Coord>
+    static float distance(const std::pair<Coord, Coord>& a, const std::pair<Coord, Coord>& b) {
+        double dx = a.first - b.first;
+        double dy = a.second - b.second;
+        double r = std::sqrt((dx * dx + dy * dy) / 10.0);
+        int t = static_cast<int>(r + 0.5);
+        return static_cast<float>(t < r ? t + 1 : t);
+    }
+};
+
+// TSPLIB GEO: great-circle distance in km. Coordinates are DDD.MM latitude/longitude,
+// converted to radians by prepare()
+struct Geo {
+    template <class Coord>
+    static std::pair<Coord, Coord> prepare(const std::pair<Coord, Coord>& p) {
+        return { static_cast<Coord>(radians(p.first)), static_cast<Coord>(radians(p.second)) };
+    }
+    template <class Coord>
+    static float distance(const std::pair<Coord, Coord>& a, const std::pair<Coord, Coord>& b) {
+        const double RRR = 6378.388;
+        double q1 = std::cos(a.second - b.second);
+        double q2 = std::cos(a.first - b.first);
+        double q3 = std::cos(a.first + b.first);
+        return static_cast<float>(static_cast<int>(RRR * std::acos(0.5 * ((1.0 + q1) * q2 - (1.0 - q1) * q3)) + 1.0));
+    }
+
+private:
+    static double radians(double x) {
+        const double PI = 3.141592;
+        int deg = static_cast<int>(x);
+        double min = x - deg;
+        return PI * (deg + 5.0 * min / 3.0) / 180.0;
+    }
+};
+
+// Borrowed, read-only distance source over a coordinate list, specialised for one metric.
+// Coordinates must already have been passed through Metric::prepare.
+template <class Metric, class Coord = double>
+class CoordinateDistance {
+public:
+    explicit CoordinateDistance(const std::vector<std::pair<Coord, Coord>>& points) : points(&points) {}
+    float operator()(int u, int v) const { return Metric::distance((*points)[u], (*points)[v]); }
+    int size() const { return static_cast<int>(points->size()); }
+
+private:
+    const std::vector<std::pair<Coord, Coord>>* points;
+};
+
+// Apply Metric::prepare to every coordinate
+template <class Metric, class Coord>
+std::vector<std::pair<Coord, Coord>> prepareCoordinates(const std::vector<std::pair<Coord, Coord>>& raw) {
+    std::vector<std::pair<Coord, Coord>> prepared;
+    prepared.reserve(raw.size());
+    for (const auto& p : raw) prepared.push_back(Metric::prepare(p));
+    return prepared;
+}
+
+#endif // METRIC_H
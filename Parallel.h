@@ -0,0 +1,39 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+// Set on worker threads, so that a parallelFor nested inside another one runs serially
+// instead of oversubscribing the machine
+inline thread_local bool insideParallelFor = false;
+
+// Number of worker threads used for n independent tasks
+inline int parallelWorkers(int n) {
+    if (insideParallelFor) return 1;
+    int hw = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    return std::max(1, std::min(n, hw));
+}
+
+// Run body(task, worker) for task = 0..n-1, with tasks strided over parallelWorkers(n) threads.
+// The worker index lets each thread keep its own scratch state without locking.
+template <class Body>
+void parallelFor(int n, Body body) {
+    int workers = parallelWorkers(n);
+    if (workers == 1) {
+        for (int i = 0; i < n; ++i) body(i, 0);
+        return;
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(workers);
+    for (int t = 0; t < workers; ++t) {
+        threads.emplace_back([&body, n, workers, t]() {
+            insideParallelFor = true;
+            for (int i = t; i < n; i += workers) body(i, t);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+}
+
+#endif // PARALLEL_H
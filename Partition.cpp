@@ -0,0 +1,38 @@
+#include "Partition.h"
+#include <algorithm>
+#include <numeric>
+
+std::vector<std::vector<int>> kdTiles(const std::vector<std::pair<double, double>>& points, int tileSize) {
+    std::vector<int> ids(points.size());
+    std::iota(ids.begin(), ids.end(), 0);
+    std::vector<std::vector<int>> tiles;
+    tileSize = std::max(tileSize, 1);
+
+    // Ranges of ids still to be split; each split is at the median across the wider side
+    std::vector<std::pair<size_t, size_t>> pending = { { 0, ids.size() } };
+    while (!pending.empty()) {
+        size_t first = pending.back().first, last = pending.back().second;
+        pending.pop_back();
+        if (last - first <= static_cast<size_t>(tileSize)) {
+            if (last > first) tiles.emplace_back(ids.begin() + first, ids.begin() + last);
+            continue;
+        }
+
+        double minX = points[ids[first]].first, maxX = minX;
+        double minY = points[ids[first]].second, maxY = minY;
+        for (size_t i = first; i < last; ++i) {
+            minX = std::min(minX, points[ids[i]].first);
+            maxX = std::max(maxX, points[ids[i]].first);
+            minY = std::min(minY, points[ids[i]].second);
+            maxY = std::max(maxY, points[ids[i]].second);
+        }
+        bool splitX = maxX - minX >= maxY - minY;
+        size_t mid = first + (last - first) / 2;
+        std::nth_element(ids.begin() + first, ids.begin() + mid, ids.begin() + last, [&](int a, int b) {
+            return splitX ? points[a].first < points[b].first : points[a].second < points[b].second;
+        });
+        pending.push_back({ mid, last });
+        pending.push_back({ first, mid });
+    }
+    return tiles;
+}
@@ -0,0 +1,154 @@
+#ifndef PARTITION_H
+#define PARTITION_H
+
+#include <vector>
+#include "Tour.h"
+#include "Timing.h"
+
+// Divide-and-conquer tours for very large coordinate instances: the plane is cut into k-d tiles,
+// each tile is solved on its own (in parallel) with constructTour, the tile tours are opened and
+// chained in the order of a tour through the tile centroids, and the seams are smoothed with 2-opt.
+
+struct PartitionOptions {
+    int tileSize = 500;     // Maximum number of cities per tile
+    int starts = 4;         // Nearest-neighbor starts per tile
+    int smoothWindow = 100; // Cities on each side of a seam given to 2-opt, 0 to skip smoothing
+};
+
+struct PartitionStats {
+    int tiles = 0;
+    double partitionMs = 0, solveMs = 0, stitchMs = 0, smoothMs = 0;
+    double stitchedLength = 0; // Before smoothing
+    double length = 0;         // Final tour length
+};
+
+// Split points into tiles of at most tileSize cities by recursive median cuts across the wider side
+std::vector<std::vector<int>> kdTiles(const std::vector<std::pair<double, double>>& points, int tileSize);
+
+// Distance over a window of a tour (local index i = window[i]). The two window ends are glued
+// together by a very negative edge, so 2-opt on the window as a cycle never removes that edge
+// and the window stays a path with fixed endpoints.
+template <class Distance>
+class WindowDistance {
+public:
+    WindowDistance(const Distance& dist, const std::vector<int>& window) : dist(&dist), window(&window) {}
+    float operator()(int u, int v) const {
+        int last = size() - 1;
+        if ((u == 0 && v == last) || (u == last && v == 0)) return -1e30f;
+        return (*dist)((*window)[u], (*window)[v]);
+    }
+    int size() const { return static_cast<int>(window->size()); }
+
+private:
+    const Distance* dist;
+    const std::vector<int>* window;
+};
+
+// points must already be prepared for Metric
+template <class Metric>
+std::vector<int> partitionedTour(const std::vector<std::pair<double, double>>& points, const PartitionOptions& options, PartitionStats& stats) {
+    using Point = std::pair<double, double>;
+    CoordinateDistance<Metric> dist(points);
+    int n = static_cast<int>(points.size());
+    auto clock = std::chrono::steady_clock::now();
+
+    std::vector<std::vector<int>> tiles = kdTiles(points, options.tileSize);
+    int k = static_cast<int>(tiles.size());
+    stats.tiles = k;
+    stats.partitionMs = elapsedMs(clock);
+
+    // Solve every tile independently; the tile tours are mapped back to global ids
+    std::vector<std::vector<int>> tileTours(k);
+    parallelFor(k, [&](int t, int) {
+        std::vector<Point> local;
+        local.reserve(tiles[t].size());
+        for (int v : tiles[t]) local.push_back(points[v]);
+        ConstructionResult solved = constructTour(CoordinateDistance<Metric>(local), options.starts);
+        tileTours[t].reserve(solved.tour.size());
+        for (int i : solved.tour) tileTours[t].push_back(tiles[t][i]);
+    });
+    stats.solveMs = elapsedMs(clock);
+
+    // Visit the tiles in the order of a tour through their centroids
+    std::vector<Point> centroids(k, { 0.0, 0.0 });
+    for (int t = 0; t < k; ++t) {
+        for (int v : tiles[t]) {
+            centroids[t].first += points[v].first;
+            centroids[t].second += points[v].second;
+        }
+        centroids[t].first /= tiles[t].size();
+        centroids[t].second /= tiles[t].size();
+    }
+    std::vector<int> order = k > 1 ? constructTour(CoordinateDistance<Metric>(centroids), options.starts).tour : std::vector<int>{ 0 };
+
+    // Open each tile tour at the edge that best links the previous tile's exit to the next tile,
+    // and append it as a path. seams[i] is the tour position where tile i's path starts.
+    std::vector<int> tour;
+    tour.reserve(n);
+    std::vector<int> seams;
+    int minPath = n;
+    for (int i = 0; i < k; ++i) {
+        const std::vector<int>& cycle = tileTours[order[i]];
+        const Point& nextCentroid = centroids[order[(i + 1) % k]];
+        int m = static_cast<int>(cycle.size());
+        auto entryCost = [&](int a) {
+            return tour.empty() ? Metric::distance(centroids[order[(i + k - 1) % k]], points[a]) : dist(tour.back(), a);
+        };
+
+        int bestEdge = 0;
+        bool forward = true;
+        double bestCost = 0;
+        for (int e = 0; e < m; ++e) {
+            int a = cycle[e], b = cycle[(e + 1) % m];
+            double cut = m > 1 ? dist(a, b) : 0;
+            // Forward: enter at b, walk the cycle onwards, leave at a. Backward: enter at a, leave at b.
+            double costForward = entryCost(b) - cut + Metric::distance(points[a], nextCentroid);
+            double costBackward = entryCost(a) - cut + Metric::distance(points[b], nextCentroid);
+            if (e == 0 || costForward < bestCost) {
+                bestCost = costForward;
+                bestEdge = e;
+                forward = true;
+            }
+            if (costBackward < bestCost) {
+                bestCost = costBackward;
+                bestEdge = e;
+                forward = false;
+            }
+        }
+        seams.push_back(static_cast<int>(tour.size()));
+        for (int step = 0; step < m; ++step) {
+            int idx = forward ? (bestEdge + 1 + step) % m : (bestEdge - step + m) % m;
+            tour.push_back(cycle[idx]);
+        }
+        minPath = std::min(minPath, m);
+    }
+    stats.stitchedLength = cycleLength(tour, dist);
+    stats.stitchMs = elapsedMs(clock);
+
+    // Smooth every seam with 2-opt on a window around it. Windows are at most half the shortest
+    // tile path on each side, so they do not overlap and can run in parallel.
+    int half = std::min(options.smoothWindow, minPath / 2);
+    if (k > 1 && half >= 2) {
+        parallelFor(k, [&](int s, int) {
+            std::vector<int> window;
+            window.reserve(2 * half);
+            for (int i = -half; i < half; ++i) window.push_back(tour[(seams[s] + i + n) % n]);
+            std::vector<int> local(window.size());
+            for (size_t i = 0; i < local.size(); ++i) local[i] = static_cast<int>(i);
+            twoOpt(local, WindowDistance<CoordinateDistance<Metric>>(dist, window));
+
+            // Rotate the window cycle back to start at its fixed first city (the glued edge is kept)
+            size_t zero = std::find(local.begin(), local.end(), 0) - local.begin();
+            bool reversed = local[(zero + 1) % local.size()] == static_cast<int>(local.size()) - 1;
+            for (size_t i = 0; i < local.size(); ++i) {
+                size_t j = reversed ? (zero + local.size() - i) % local.size() : (zero + i) % local.size();
+                tour[(seams[s] - half + static_cast<int>(i) + n) % n] = window[local[j]];
+            }
+        });
+    }
+    stats.smoothMs = elapsedMs(clock);
+    stats.length = cycleLength(tour, dist);
+    return tour;
+}
+
+#endif // PARTITION_H
@@ -0,0 +1,173 @@
+#include "Reads.h"
+#include <algorithm>
+#include <unordered_set>
+
+StringReads::StringReads() : reads(1) {}
+
+bool StringReads::append(const std::string& read) {
+    reads.push_back(read);
+    return true;
+}
+
+void StringReads::removeDuplicates() {
+    std::unordered_set<std::string> seen;
+    std::vector<std::string> unique(1);
+    for (size_t id = 1; id < reads.size(); ++id) {
+        if (seen.insert(reads[id]).second) unique.push_back(std::move(reads[id]));
+    }
+    reads.swap(unique);
+}
+
+int StringReads::overlap(int a, int b) const {
+    const std::string& s = reads[a];
+    const std::string& t = reads[b];
+    for (int k = static_cast<int>(std::min(s.size(), t.size())); k > 0; --k) {
+        if (s.compare(s.size() - k, k, t, 0, k) == 0) return k;
+    }
+    return 0;
+}
+
+void StringReads::appendPrefix(std::string& out, int id, int count) const {
+    out.append(reads[id], 0, count);
+}
+
+std::size_t StringReads::memoryBytes() const {
+    std::size_t bytes = reads.capacity() * sizeof(std::string);
+    for (const auto& read : reads) {
+        if (read.capacity() > 15) bytes += read.capacity() + 1; // Beyond the small-string buffer
+    }
+    return bytes;
+}
+
+// Mask selecting the first n bases (2 bits each) of a 64-bit word, n <= 32
+static std::uint64_t baseMask(std::uint64_t n) {
+    return n >= 32 ? ~std::uint64_t(0) : (std::uint64_t(1) << (2 * n)) - 1;
+}
+
+// Append the first n bases of v at base position pos of a packed buffer
+static void appendBases(std::vector<std::uint64_t>& words, std::uint64_t& pos, std::uint64_t v, std::uint64_t n) {
+    v &= baseMask(n);
+    size_t idx = pos >> 5;
+    unsigned shift = static_cast<unsigned>(pos & 31) * 2;
+    if (idx >= words.size()) words.push_back(0);
+    words[idx] |= v << shift;
+    if (shift && 2 * n > 64 - shift) {
+        if (idx + 1 >= words.size()) words.push_back(0);
+        words[idx + 1] |= v >> (64 - shift);
+    }
+    pos += n;
+}
+
+PackedReads::PackedReads() : offsets{ 0, 0 } {}
+
+bool PackedReads::append(const std::string& read) {
+    for (char c : read) {
+        if (c != 'A' && c != 'C' && c != 'G' && c != 'T' && c != 'a' && c != 'c' && c != 'g' && c != 't') return false;
+    }
+    std::uint64_t pos = offsets.back();
+    for (char c : read) {
+        std::uint64_t code = 0;
+        switch (c) {
+        case 'C': case 'c': code = 1; break;
+        case 'G': case 'g': code = 2; break;
+        case 'T': case 't': code = 3; break;
+        default: break;
+        }
+        appendBases(words, pos, code, 1);
+    }
+    offsets.push_back(pos);
+    return true;
+}
+
+std::uint64_t PackedReads::window(int id, std::uint64_t pos) const {
+    std::uint64_t g = offsets[id] + pos;
+    size_t idx = g >> 5;
+    unsigned shift = static_cast<unsigned>(g & 31) * 2;
+    std::uint64_t v = words[idx] >> shift;
+    if (shift && idx + 1 < words.size()) v |= words[idx + 1] << (64 - shift);
+    return v;
+}
+
+int PackedReads::overlap(int a, int b) const {
+    int la = length(a), lb = length(b);
+    for (int k = std::min(la, lb); k > 0; --k) {
+        // Compare the last k bases of a with the first k bases of b, 32 bases at a time
+        std::uint64_t start = la - k;
+        bool match = true;
+        for (int i = 0; i < k && match; i += 32) {
+            std::uint64_t n = std::min(32, k - i);
+            match = ((window(a, start + i) ^ window(b, i)) & baseMask(n)) == 0;
+        }
+        if (match) return k;
+    }
+    return 0;
+}
+
+void PackedReads::appendPrefix(std::string& out, int id, int count) const {
+    static const char bases[] = "ACGT";
+    for (int i = 0; i < count; ++i) {
+        std::uint64_t g = offsets[id] + i;
+        out.push_back(bases[(words[g >> 5] >> ((g & 31) * 2)) & 3]);
+    }
+}
+
+std::size_t PackedReads::memoryBytes() const {
+    return words.capacity() * sizeof(std::uint64_t) + offsets.capacity() * sizeof(std::uint64_t);
+}
+
+bool PackedReads::sameRead(int a, int b) const {
+    int len = length(a);
+    if (len != length(b)) return false;
+    for (int i = 0; i < len; i += 32) {
+        if ((window(a, i) ^ window(b, i)) & baseMask(std::min(32, len - i))) return false;
+    }
+    return true;
+}
+
+std::uint64_t PackedReads::hashRead(int id) const {
+    int len = length(id);
+    std::uint64_t h = 1469598103934665603ULL ^ static_cast<std::uint64_t>(len);
+    for (int i = 0; i < len; i += 32) {
+        h ^= window(id, i) & baseMask(std::min(32, len - i));
+        h *= 1099511628211ULL;
+        h ^= h >> 29;
+    }
+    return h;
+}
+
+void PackedReads::removeDuplicates() {
+    // Group reads by hash; within a group, a read equal to an earlier id is a duplicate
+    int n = size();
+    std::vector<std::pair<std::uint64_t, int>> order;
+    order.reserve(n);
+    for (int id = 1; id < n; ++id) order.emplace_back(hashRead(id), id);
+    std::sort(order.begin(), order.end());
+
+    std::vector<char> duplicate(n, 0);
+    for (size_t first = 0; first < order.size();) {
+        size_t last = first;
+        while (last < order.size() && order[last].first == order[first].first) ++last;
+        for (size_t i = first + 1; i < last; ++i) {
+            for (size_t j = first; j < i; ++j) {
+                if (!duplicate[order[j].second] && sameRead(order[j].second, order[i].second)) {
+                    duplicate[order[i].second] = 1;
+                    break;
+                }
+            }
+        }
+        first = last;
+    }
+
+    // Repack the kept reads in their original order
+    std::vector<std::uint64_t> packed;
+    std::vector<std::uint64_t> newOffsets = { 0, 0 };
+    std::uint64_t pos = 0;
+    for (int id = 1; id < n; ++id) {
+        if (duplicate[id]) continue;
+        int len = length(id);
+        for (int i = 0; i < len; i += 32) appendBases(packed, pos, window(id, i), std::min(32, len - i));
+        newOffsets.push_back(pos);
+    }
+    words.swap(packed);
+    offsets.swap(newOffsets);
+}
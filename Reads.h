@@ -0,0 +1,50 @@
+#ifndef READS_H
+#define READS_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// Read stores for the shortest superstring solver (Algorithm 7). Reads are referred to by integer id;
+// id 0 is always the empty string, which the distance graph uses as its start/end vertex.
+
+// Reads kept as plain strings (any alphabet)
+class StringReads {
+public:
+    StringReads();
+    bool append(const std::string& read); // Always succeeds
+    void removeDuplicates();              // Keep the first occurrence of each read, ids are renumbered
+    int size() const { return static_cast<int>(reads.size()); }
+    int length(int id) const { return static_cast<int>(reads[id].size()); }
+    int overlap(int a, int b) const;      // Longest suffix of a that is a prefix of b
+    void appendPrefix(std::string& out, int id, int count) const; // Append the first count characters of read id
+    std::size_t memoryBytes() const;
+
+private:
+    std::vector<std::string> reads;
+};
+
+// Nucleotide reads packed at 2 bits per base (A=0, C=1, G=2, T=3) in one contiguous buffer.
+// Overlaps are compared 32 bases per 64-bit word.
+class PackedReads {
+public:
+    PackedReads();
+    bool append(const std::string& read); // False if the read has a character other than ACGT
+    void removeDuplicates();
+    int size() const { return static_cast<int>(offsets.size()) - 1; }
+    int length(int id) const { return static_cast<int>(offsets[id + 1] - offsets[id]); }
+    int overlap(int a, int b) const;
+    void appendPrefix(std::string& out, int id, int count) const;
+    std::size_t memoryBytes() const;
+
+private:
+    std::vector<std::uint64_t> words;   // Base i of the buffer is in bits 2*(i%32) of words[i/32]
+    std::vector<std::uint64_t> offsets; // Read id covers bases [offsets[id], offsets[id+1])
+
+    std::uint64_t window(int id, std::uint64_t pos) const; // 32 bases of read id starting at pos
+    bool sameRead(int a, int b) const;
+    std::uint64_t hashRead(int id) const;
+};
+
+#endif // READS_H
@@ -0,0 +1,191 @@
+#include "TSPLIB.h"
+#include "Metric.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+static std::string trim(const std::string& s) {
+    size_t first = s.find_first_not_of(" \t\r");
+    if (first == std::string::npos) return "";
+    size_t last = s.find_last_not_of(" \t\r");
+    return s.substr(first, last - first + 1);
+}
+
+bool isTSPLIBFile(const std::string& inputFile) {
+    std::ifstream inFile(inputFile);
+    std::string line;
+    while (std::getline(inFile, line)) {
+        line = trim(line);
+        if (line.empty()) continue;
+        return line.find(':') != std::string::npos || line.compare(0, 4, "NAME") == 0;
+    }
+    return false;
+}
+
+// Read the EDGE_WEIGHT_SECTION into a full symmetric matrix
+static void readEdgeWeights(std::istream& in, TSPLIBInstance& instance, const std::string& format) {
+    int n = instance.dimension;
+    instance.matrix.assign(static_cast<size_t>(n) * n, 0);
+    auto set = [&](int i, int j) {
+        float w;
+        if (!(in >> w)) {
+            std::cerr << "Error reading EDGE_WEIGHT_SECTION." << std::endl;
+            exit(102);
+        }
+        instance.matrix[static_cast<size_t>(i) * n + j] = w;
+        instance.matrix[static_cast<size_t>(j) * n + i] = w;
+    };
+
+    // By symmetry the column formats are the transposed row formats
+    if (format == "FULL_MATRIX") {
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j < n; ++j) set(i, j);
+    }
+    else if (format == "UPPER_ROW" || format == "LOWER_COL") {
+        for (int i = 0; i < n; ++i)
+            for (int j = i + 1; j < n; ++j) set(i, j);
+    }
+    else if (format == "LOWER_ROW" || format == "UPPER_COL") {
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j < i; ++j) set(i, j);
+    }
+    else if (format == "UPPER_DIAG_ROW" || format == "LOWER_DIAG_COL") {
+        for (int i = 0; i < n; ++i)
+            for (int j = i; j < n; ++j) set(i, j);
+    }
+    else if (format == "LOWER_DIAG_ROW" || format == "UPPER_DIAG_COL") {
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j <= i; ++j) set(i, j);
+    }
+    else {
+        std::cerr << "Unsupported EDGE_WEIGHT_FORMAT " << format << "." << std::endl;
+        exit(102);
+    }
+}
+
+TSPLIBInstance readTSPLIB(const std::string& inputFile) {
+    std::ifstream inFile(inputFile);
+    if (!inFile) {
+        std::cerr << "Cannot open graph file" << inputFile << std::endl;
+        exit(101);
+    }
+
+    TSPLIBInstance instance;
+    std::string format = "FULL_MATRIX";
+    std::string line;
+    while (std::getline(inFile, line)) {
+        line = trim(line);
+        if (line.empty()) continue;
+        size_t colon = line.find(':');
+        std::string key = trim(line.substr(0, colon));
+        std::string value = colon == std::string::npos ? "" : trim(line.substr(colon + 1));
+
+        if (key == "NAME") {
+            instance.name = value;
+        }
+        else if (key == "TYPE") {
+            if (value != "TSP") {
+                std::cerr << "Only symmetric TSP instances are supported, got TYPE " << value << "." << std::endl;
+                exit(102);
+            }
+        }
+        else if (key == "DIMENSION") {
+            instance.dimension = std::stoi(value);
+        }
+        else if (key == "EDGE_WEIGHT_TYPE") {
+            if (value == "EUC_2D") instance.type = EdgeWeightType::Euc2D;
+            else if (value == "CEIL_2D") instance.type = EdgeWeightType::Ceil2D;
+            else if (value == "GEO") instance.type = EdgeWeightType::Geo;
+            else if (value == "ATT") instance.type = EdgeWeightType::Att;
+            else if (value == "EXPLICIT") instance.type = EdgeWeightType::Explicit;
+            else {
+                std::cerr << "Unsupported EDGE_WEIGHT_TYPE " << value << "." << std::endl;
+                exit(102);
+            }
+        }
+        else if (key == "EDGE_WEIGHT_FORMAT") {
+            format = value;
+        }
+        else if (key == "NODE_COORD_SECTION") {
+            instance.coords.resize(instance.dimension);
+            for (int i = 0; i < instance.dimension; ++i) {
+                int id;
+                double x, y;
+                if (!(inFile >> id >> x >> y) || id < 1 || id > instance.dimension) {
+                    std::cerr << "Error processing NODE_COORD_SECTION entry " << i + 1 << "." << std::endl;
+                    exit(102);
+                }
+                instance.coords[id - 1] = { x, y };
+            }
+        }
+        else if (key == "EDGE_WEIGHT_SECTION") {
+            readEdgeWeights(inFile, instance, format);
+        }
+        else if (key == "DISPLAY_DATA_SECTION") {
+            for (int i = 0; i < instance.dimension; ++i) std::getline(inFile >> std::ws, line);
+        }
+        else if (key == "EOF") {
+            break;
+        }
+        // Other keys (COMMENT, DISPLAY_DATA_TYPE, ...) do not affect the instance
+    }
+
+    bool hasData = instance.type == EdgeWeightType::Explicit ? !instance.matrix.empty() : !instance.coords.empty();
+    if (instance.dimension <= 0 || !hasData) {
+        std::cerr << "Incomplete TSPLIB file " << inputFile << "." << std::endl;
+        exit(102);
+    }
+    return instance;
+}
+
+TSPLIBInstance readInstance(const std::string& inputFile) {
+    if (isTSPLIBFile(inputFile)) return readTSPLIB(inputFile);
+
+    TSPLIBInstance instance;
+    std::vector<std::pair<float, float>> points = readCoordinates(inputFile);
+    instance.dimension = static_cast<int>(points.size());
+    instance.type = EdgeWeightType::Euclidean;
+    instance.coords.assign(points.begin(), points.end());
+    return instance;
+}
+
+template <class Distance>
+static void fillCompleteGraph(Graph& g, const Distance& dist) {
+    for (int i = 0; i < g.V; ++i) {
+        for (int j = i + 1; j < g.V; ++j) {
+            g.addEdge(i, j, dist(i, j));
+        }
+    }
+}
+
+template <class Metric>
+static void fillCompleteGraph(Graph& g, const TSPLIBInstance& instance) {
+    std::vector<std::pair<double, double>> points = prepareCoordinates<Metric>(instance.coords);
+    fillCompleteGraph(g, CoordinateDistance<Metric>(points));
+}
+
+Graph tsplibGraph(const TSPLIBInstance& instance, std::pmr::memory_resource* mr) {
+    int V = instance.dimension;
+    Graph g(V, V * (V - 1) / 2, mr);  // Complete graph
+    switch (instance.type) {
+    case EdgeWeightType::Euclidean: fillCompleteGraph<Euclidean>(g, instance); break;
+    case EdgeWeightType::Euc2D: fillCompleteGraph<Euc2D>(g, instance); break;
+    case EdgeWeightType::Ceil2D: fillCompleteGraph<Ceil2D>(g, instance); break;
+    case EdgeWeightType::Geo: fillCompleteGraph<Geo>(g, instance); break;
+    case EdgeWeightType::Att: fillCompleteGraph<Att>(g, instance); break;
+    case EdgeWeightType::Explicit: fillCompleteGraph(g, ExplicitDistance(instance)); break;
+    }
+    return g;
+}
+
+const char* edgeWeightTypeName(EdgeWeightType type) {
+    switch (type) {
+    case EdgeWeightType::Euclidean: return "Euclidean";
+    case EdgeWeightType::Euc2D: return "EUC_2D";
+    case EdgeWeightType::Ceil2D: return "CEIL_2D";
+    case EdgeWeightType::Geo: return "GEO";
+    case EdgeWeightType::Att: return "ATT";
+    case EdgeWeightType::Explicit: return "EXPLICIT";
+    }
+    return "";
+}
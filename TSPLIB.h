@@ -0,0 +1,38 @@
+#ifndef TSPLIB_H
+#define TSPLIB_H
+
+#include <vector>
+#include <string>
+#include <memory_resource>
+#include "Graph.h"
+
+enum class EdgeWeightType { Euclidean, Euc2D, Ceil2D, Geo, Att, Explicit };
+
+// A symmetric TSP instance read from a TSPLIB file (or from a Type 2 coordinate file)
+struct TSPLIBInstance {
+    std::string name;
+    int dimension = 0;
+    EdgeWeightType type = EdgeWeightType::Euclidean;
+    std::vector<std::pair<double, double>> coords; // Raw NODE_COORD_SECTION, vertex i = node i + 1
+    std::vector<float> matrix;                     // EXPLICIT weights as a full dimension x dimension matrix
+};
+
+// Borrowed distance source over the full matrix of an EXPLICIT instance
+class ExplicitDistance {
+public:
+    explicit ExplicitDistance(const TSPLIBInstance& instance) : weights(instance.matrix.data()), n(instance.dimension) {}
+    float operator()(int u, int v) const { return weights[static_cast<size_t>(u) * n + v]; }
+    int size() const { return n; }
+
+private:
+    const float* weights;
+    int n;
+};
+
+bool isTSPLIBFile(const std::string& inputFile); // True if the file starts with a TSPLIB "KEY : value" header
+TSPLIBInstance readTSPLIB(const std::string& inputFile);
+TSPLIBInstance readInstance(const std::string& inputFile); // TSPLIB, or a Type 2 file as a Euclidean instance
+Graph tsplibGraph(const TSPLIBInstance& instance, std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+const char* edgeWeightTypeName(EdgeWeightType type);
+
+#endif // TSPLIB_H
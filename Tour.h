@@ -0,0 +1,432 @@
+#ifndef TOUR_H
+#define TOUR_H
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <cfloat>
+#include <tuple>
+#include "Graph.h"
+#include "Parallel.h"
+#include "Metric.h"
+
+// Borrowed, read-only distance source over a graph's adjacency matrix.
+// The graph must outlive the view.
+class MatrixDistance {
+public:
+    explicit MatrixDistance(const Graph& g) : rows(g.adjMatrix.data()), n(g.V) {}
+    float operator()(int u, int v) const { return rows[u][v]; }
+    int size() const { return n; }
+
+private:
+    const std::pmr::vector<float>* rows;
+    int n;
+};
+
+// Euclidean distance source over Type 2 coordinates, computed on demand so no V x V matrix is needed
+using PointDistance = CoordinateDistance<Euclidean, float>;
+
+// Fixed-size visited set, one bit per vertex
+class VisitedBits {
+public:
+    explicit VisitedBits(int n = 0) : words((n + 63) / 64, 0) {}
+    void reset(int n) { words.assign((n + 63) / 64, 0); }
+    bool test(int v) const { return (words[v >> 6] >> (v & 63)) & 1; }
+    bool testAndSet(int v) { // Returns true if v was not yet marked
+        std::uint64_t bit = std::uint64_t(1) << (v & 63);
+        bool fresh = !(words[v >> 6] & bit);
+        words[v >> 6] |= bit;
+        return fresh;
+    }
+
+private:
+    std::vector<std::uint64_t> words;
+};
+
+// Length of the closed tour cycle[0] -> ... -> cycle[n-1] -> cycle[0]
+template <class Distance>
+double cycleLength(const std::vector<int>& cycle, const Distance& dist) {
+    double length = 0;
+    for (size_t i = 0; i + 1 < cycle.size(); ++i) length += dist(cycle[i], cycle[i + 1]);
+    if (cycle.size() > 1) length += dist(cycle.back(), cycle.front());
+    return length;
+}
+
+// Write a closed tour in the Type 1 edge format: "V E" followed by one line per tour edge.
+// V can exceed the tour size when some vertex ids are not on the tour (e.g. removed cities).
+template <class Distance>
+void writeCycle(const std::vector<int>& cycle, const Distance& dist, int V, int E, const std::string& outputPath) {
+    std::ofstream outFile(outputPath);
+    if (!outFile) {
+        std::cerr << "Could not open file for writing." << std::endl;
+        exit(1);
+    }
+    outFile << V << " " << E << std::endl;
+    for (size_t i = 0; i < cycle.size(); ++i) {
+        int u = cycle[i];
+        int v = cycle[(i + 1) % cycle.size()];
+        outFile << u << " " << v << " " << dist(u, v) << '\n';
+    }
+}
+
+// Tour over all V vertices: "V V"
+template <class Distance>
+void writeCycle(const std::vector<int>& cycle, const Distance& dist, int V, const std::string& outputPath) {
+    writeCycle(cycle, dist, V, V, outputPath);
+}
+
+// Prim's algorithm on the complete graph of a distance source, O(V^2) time and O(V) memory.
+// Returns the tree as (weight, parent, child) edges.
+template <class Distance>
+std::vector<std::tuple<float, int, int>> primTree(const Distance& dist) {
+    int V = dist.size();
+    std::vector<std::tuple<float, int, int>> tree;
+    if (V == 0) return tree;
+    tree.reserve(V - 1);
+    std::vector<float> key(V, FLT_MAX);
+    std::vector<int> parent(V, -1);
+    std::vector<char> inTree(V, 0);
+    key[0] = 0;
+    for (int count = 0; count < V; ++count) {
+        int u = -1;
+        for (int v = 0; v < V; ++v) {
+            if (!inTree[v] && (u < 0 || key[v] < key[u])) u = v;
+        }
+        inTree[u] = 1;
+        if (parent[u] >= 0) tree.emplace_back(key[u], parent[u], u);
+        for (int v = 0; v < V; ++v) {
+            if (!inTree[v]) {
+                float d = dist(u, v);
+                if (d < key[v]) {
+                    key[v] = d;
+                    parent[v] = u;
+                }
+            }
+        }
+    }
+    return tree;
+}
+
+// Euler tour of the doubled tree given as adjacency lists: a vertex is recorded on entry and again
+// after each of its children returns
+inline std::vector<int> doubledTreeWalk(const std::vector<std::vector<int>>& tree, int root) {
+    std::vector<int> walk;
+    std::vector<std::pair<int, size_t>> stack = { { root, 0 } };
+    std::vector<int> parent(tree.size(), -1);
+    walk.push_back(root);
+    while (!stack.empty()) {
+        int u = stack.back().first;
+        size_t& next = stack.back().second;
+        if (next < tree[u].size()) {
+            int v = tree[u][next++];
+            if (v == parent[u]) continue;
+            parent[v] = u;
+            walk.push_back(v);
+            stack.push_back({ v, 0 });
+        }
+        else {
+            stack.pop_back();
+            if (!stack.empty()) walk.push_back(stack.back().first);
+        }
+    }
+    return walk;
+}
+
+struct ShortcutResult {
+    std::vector<int> cycle;  // Hamiltonian cycle, closing edge implied
+    double length = 0;       // Length of the best cycle
+    double firstLength = 0;  // Length from the original start and orientation
+    int start = 0;           // Position in the walk the best cycle starts from
+    bool reversed = false;   // Whether the walk was traversed backwards
+    int evaluated = 0;       // Number of start/orientation pairs tried
+};
+
+// Shortcut a closed walk (e.g. an Euler tour) into a Hamiltonian cycle, skipping repeated vertices.
+// Up to maxStarts evenly spaced starting positions are tried in both orientations, in parallel,
+// and the shortest resulting cycle is kept. Position 0 forwards is always tried, so the result is
+// never longer than the single fixed-order shortcut.
+template <class Distance>
+ShortcutResult shortcutEulerTour(const std::vector<int>& walk, int V, const Distance& dist, int maxStarts = 64) {
+    std::vector<int> tour(walk);
+    if (tour.size() > 1 && tour.front() == tour.back()) tour.pop_back(); // Treat the walk cyclically
+    int L = static_cast<int>(tour.size());
+    int starts = std::max(1, std::min(L, maxStarts));
+    int tasks = 2 * starts;
+
+    int workers = parallelWorkers(tasks);
+    std::vector<ShortcutResult> best(workers);
+    std::vector<std::vector<int>> current(workers);
+    std::vector<VisitedBits> visited(workers);
+    for (auto& b : best) b.length = -1;
+
+    auto shortcut = [&](int task, int worker) {
+        int start = static_cast<int>(static_cast<long long>(task / 2) * L / starts);
+        bool reversed = task % 2 == 1;
+        std::vector<int>& cycle = current[worker];
+        VisitedBits& seen = visited[worker];
+        cycle.clear();
+        seen.reset(V);
+
+        double length = 0;
+        double bound = best[worker].length;
+        for (int i = 0; i < L; ++i) {
+            int v = tour[reversed ? (start - i + L) % L : (start + i) % L];
+            if (seen.testAndSet(v)) {
+                if (!cycle.empty()) length += dist(cycle.back(), v);
+                cycle.push_back(v);
+                if (bound >= 0 && length >= bound && task != 0) return; // Cannot beat this worker's best
+            }
+        }
+        if (cycle.size() > 1) length += dist(cycle.back(), cycle.front());
+
+        ShortcutResult& mine = best[worker];
+        if (task == 0) mine.firstLength = length;
+        if (mine.length < 0 || length < mine.length) {
+            mine.length = length;
+            mine.start = start;
+            mine.reversed = reversed;
+            std::swap(mine.cycle, cycle);
+        }
+    };
+    parallelFor(tasks, shortcut);
+
+    ShortcutResult result;
+    result.length = -1;
+    for (auto& b : best) {
+        if (b.firstLength > 0) result.firstLength = b.firstLength;
+        if (b.length >= 0 && (result.length < 0 || b.length < result.length)) {
+            result.length = b.length;
+            result.start = b.start;
+            result.reversed = b.reversed;
+            result.cycle = std::move(b.cycle);
+        }
+    }
+    result.evaluated = tasks;
+    return result;
+}
+
+struct StartStats {
+    int start = 0;           // Starting vertex
+    bool randomized = false; // Randomized greedy run rather than plain nearest neighbor
+    bool pruned = false;     // Abandoned once its partial length exceeded the best complete tour
+    double length = 0;       // Tour length, or partial length at the point it was pruned
+};
+
+struct MultiStartResult {
+    std::vector<int> cycle;         // Best Hamiltonian cycle, closing edge implied
+    double length = 0;              // Its length
+    int bestRun = 0;                // Index into runs of the run that produced it
+    std::vector<StartStats> runs;   // One entry per run, in run order
+};
+
+// Nearest-neighbor construction from many starting vertices, spread over all cores.
+// Runs 0..starts-1 are plain nearest neighbor from evenly spaced vertices (run 0 starts at vertex 0);
+// the following randomizedRuns runs start from random vertices and move to a uniformly chosen
+// vertex among the `candidates` nearest unvisited ones. A run is abandoned as soon as its partial
+// length reaches the best complete tour found so far by any thread.
+template <class Distance>
+MultiStartResult nearestNeighborMultiStart(const Distance& dist, int starts, int randomizedRuns = 0, int candidates = 3, unsigned seed = 1) {
+    int V = dist.size();
+    if (V == 0) return MultiStartResult();
+    starts = std::max(1, std::min(starts, V));
+    randomizedRuns = std::max(0, randomizedRuns);
+    candidates = std::max(1, candidates);
+    int runs = starts + randomizedRuns;
+
+    int workers = parallelWorkers(runs);
+    std::vector<std::vector<int>> current(workers), bestCycle(workers);
+    std::vector<double> bestLength(workers, -1);
+    std::vector<int> bestRun(workers, -1);
+    std::vector<std::vector<char>> inCycle(workers);
+    std::vector<StartStats> stats(runs);
+    std::atomic<double> globalBest(-1);
+
+    auto run = [&](int r, int worker) {
+        StartStats& st = stats[r];
+        st.randomized = r >= starts;
+        std::mt19937 rng(seed + r);
+        st.start = st.randomized ? static_cast<int>(rng() % V) : static_cast<int>(static_cast<long long>(r) * V / starts);
+
+        std::vector<int>& cycle = current[worker];
+        std::vector<char>& used = inCycle[worker];
+        cycle.clear();
+        used.assign(V, 0);
+        cycle.push_back(st.start);
+        used[st.start] = 1;
+
+        std::vector<std::pair<float, int>> nearest; // Candidate list for randomized runs, sorted ascending
+        double length = 0;
+        for (int i = 1; i < V; ++i) {
+            int last = cycle.back();
+            int next = -1;
+            if (!st.randomized || candidates == 1) {
+                float minDist = 0;
+                for (int j = 0; j < V; ++j) {
+                    if (!used[j] && (next < 0 || dist(last, j) < minDist)) {
+                        next = j;
+                        minDist = dist(last, j);
+                    }
+                }
+            }
+            else {
+                nearest.clear();
+                for (int j = 0; j < V; ++j) {
+                    if (used[j]) continue;
+                    float d = dist(last, j);
+                    if (static_cast<int>(nearest.size()) < candidates || d < nearest.back().first) {
+                        auto pos = std::upper_bound(nearest.begin(), nearest.end(), std::make_pair(d, j));
+                        nearest.insert(pos, { d, j });
+                        if (static_cast<int>(nearest.size()) > candidates) nearest.pop_back();
+                    }
+                }
+                next = nearest[rng() % nearest.size()].second;
+            }
+            length += dist(last, next);
+            cycle.push_back(next);
+            used[next] = 1;
+
+            double bound = globalBest.load(std::memory_order_relaxed);
+            if (bound >= 0 && length >= bound) {
+                st.pruned = true;
+                st.length = length;
+                return;
+            }
+        }
+        if (V > 1) length += dist(cycle.back(), cycle.front());
+        st.length = length;
+
+        double bound = globalBest.load();
+        while ((bound < 0 || length < bound) && !globalBest.compare_exchange_weak(bound, length)) {}
+        if (bestLength[worker] < 0 || length < bestLength[worker]) {
+            bestLength[worker] = length;
+            bestRun[worker] = r;
+            std::swap(bestCycle[worker], cycle);
+        }
+    };
+    parallelFor(runs, run);
+
+    MultiStartResult result;
+    result.length = -1;
+    for (int w = 0; w < workers; ++w) {
+        if (bestRun[w] >= 0 && (result.length < 0 || bestLength[w] < result.length)) {
+            result.length = bestLength[w];
+            result.bestRun = bestRun[w];
+            result.cycle = std::move(bestCycle[w]);
+        }
+    }
+    result.runs = std::move(stats);
+    return result;
+}
+
+// 2-opt local search on a closed tour. Only moves that replace a tour edge incident to a vertex in
+// the work list are tried; vertices touched by an applied move are queued again. An empty focus
+// means every vertex. Stops after maxMoves moves (negative for no limit). Returns the total gain.
+template <class Distance>
+double twoOpt(std::vector<int>& cycle, const Distance& dist, std::vector<int> focus = {}, int maxMoves = -1) {
+    int n = static_cast<int>(cycle.size());
+    if (n < 4) return 0;
+    int maxId = *std::max_element(cycle.begin(), cycle.end());
+    std::vector<int> pos(maxId + 1, -1);
+    for (int i = 0; i < n; ++i) pos[cycle[i]] = i;
+
+    std::vector<char> queued(maxId + 1, 0);
+    std::vector<int> work;
+    if (focus.empty()) focus = cycle;
+    for (int v : focus) {
+        if (v <= maxId && pos[v] >= 0 && !queued[v]) {
+            queued[v] = 1;
+            work.push_back(v);
+        }
+    }
+    auto enqueue = [&](int v) {
+        if (!queued[v]) {
+            queued[v] = 1;
+            work.push_back(v);
+        }
+    };
+    // Reverse the cyclic segment cycle[from..to], or its complement when that is shorter (same tour)
+    auto reverseSegment = [&](int from, int to) {
+        int len = (to - from + n) % n + 1;
+        if (2 * len > n) {
+            int nextFrom = (to + 1) % n;
+            to = (from - 1 + n) % n;
+            from = nextFrom;
+            len = n - len;
+        }
+        for (int k = 0; k < len / 2; ++k) {
+            int a = (from + k) % n, b = (to - k + n) % n;
+            std::swap(cycle[a], cycle[b]);
+            pos[cycle[a]] = a;
+            pos[cycle[b]] = b;
+        }
+    };
+
+    double gain = 0;
+    int moves = 0;
+    while (!work.empty() && (maxMoves < 0 || moves < maxMoves)) {
+        int a = work.back();
+        work.pop_back();
+        queued[a] = 0;
+
+        for (int side = 0; side < 2; ++side) {
+            int i = side == 0 ? pos[a] : (pos[a] - 1 + n) % n; // Tour edge (cycle[i], cycle[i+1]) touching a
+            int p = cycle[i], q = cycle[(i + 1) % n];
+            float dpq = dist(p, q);
+            bool moved = false;
+            for (int j = 0; j < n; ++j) {
+                if (j == i || j == (i + 1) % n || (j + 1) % n == i) continue;
+                int r = cycle[j], s = cycle[(j + 1) % n];
+                double delta = static_cast<double>(dist(p, r)) + dist(q, s) - dpq - dist(r, s);
+                if (delta < -1e-6) {
+                    reverseSegment((i + 1) % n, j); // p q ... r s  ->  p r ... q s
+                    gain -= delta;
+                    moves++;
+                    enqueue(p); enqueue(q); enqueue(r); enqueue(s);
+                    moved = true;
+                    break;
+                }
+            }
+            if (moved) break; // a is queued again, its edges are re-examined from the new positions
+        }
+    }
+    return gain;
+}
+
+struct ConstructionResult {
+    std::vector<int> tour;  // Final tour, closing edge implied
+    double mstWeight = 0;   // Lower bound for the tour length
+    double doubleTree = 0;  // Length of the best doubled-MST shortcut
+    double nearest = 0;     // Length of the best nearest-neighbor tour
+    double length = 0;      // Length after 2-opt
+};
+
+// Matrix-free tour construction: double tree (Prim MST, best shortcut of the doubled tree) and
+// multi-start nearest neighbor, the shorter one improved by 2-opt
+template <class Distance>
+ConstructionResult constructTour(const Distance& dist, int starts) {
+    ConstructionResult result;
+    int V = dist.size();
+    if (V == 0) return result;
+    std::vector<std::vector<int>> tree(V);
+    for (const auto& edge : primTree(dist)) {
+        tree[std::get<1>(edge)].push_back(std::get<2>(edge));
+        tree[std::get<2>(edge)].push_back(std::get<1>(edge));
+        result.mstWeight += std::get<0>(edge);
+    }
+    ShortcutResult doubleTree = shortcutEulerTour(doubledTreeWalk(tree, 0), V, dist);
+    MultiStartResult nearest = nearestNeighborMultiStart(dist, starts);
+    result.doubleTree = doubleTree.length;
+    result.nearest = nearest.length;
+
+    result.tour = nearest.length < doubleTree.length ? std::move(nearest.cycle) : std::move(doubleTree.cycle);
+    twoOpt(result.tour, dist, {}, 10 * V);
+    result.length = cycleLength(result.tour, dist);
+    return result;
+}
+
+#endif // TOUR_H
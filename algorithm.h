@@ -5,17 +5,31 @@
 
 void runAlgorithm1(const std::string& inputFile, const std::string& outputFile);
 
-void runAlgorithm2(const std::string& inputFile, const std::string& outputFile);
+// Pipeline stages shared by Algorithms 1, 2, 5 and 6; graphs are allocated from mr,
+// so a pipeline can run all its stages in one arena
+void eulerTourStage(const std::string& inputFile, const std::string& outputFile, std::pmr::memory_resource* mr);
+
+void kruskalMSTStage(const std::string& inputFile, const std::string& outputFile, std::pmr::memory_resource* mr);
+
+void runAlgorithm2(const std::string& inputFile, const std::string& outputFile, double memoryBudgetMB = 0);
 
 void runAlgorithm3(const std::string& inputFile, const std::string& outputFile);
 
-void runAlgorithm4(const std::string& inputFile, const std::string& outputFile);
+void runAlgorithm4(const std::string& inputFile, const std::string& outputFile, int starts = 1, int randomizedRuns = 0);
 
 void runAlgorithm5(const std::string& inputFile, const std::string& outputFile);
 
 void runAlgorithm6(const std::string& inputFile, const std::string& outputFile);
 
-void runAlgorithm7(const std::string& inputFile, const std::string& outputFile);
+void runAlgorithm7(const std::string& inputFile, const std::string& outputFile, bool nucleotides = false);
+
+void runAlgorithm8(const std::string& inputFile, const std::string& outputFile, const std::string& updatesFile);
+
+void runAlgorithm9(const std::string& inputFile, const std::string& outputFile, int starts = 8);
+
+void runAlgorithm10(const std::string& inputFile, const std::string& outputFile, int tileSize = 500, int smoothWindow = 100);
+
+void runMetricBenchmark(const std::string& inputFile, const std::string& outputFile);
 
 std::string readToolPath();
 
@@ -2,8 +2,14 @@
 #include <iostream>
 #include <fstream>
 
+void eulerTourStage(const std::string& inputFile, const std::string& outputFile, std::pmr::memory_resource* mr) {
+    Graph g = create_graph(inputFile, mr);
+    g.printEulerTour(outputFile);
+}
+
 void runAlgorithm1(const std::string& inputFilePath, const std::string& outputFilePath) {
-    Graph g = create_graph(inputFilePath);
-    g.printEulerTour(outputFilePath);
+    RunArena arena;
+    eulerTourStage(inputFilePath, outputFilePath, arena.resource());
     std::cout << "Eulerian tour generated by algorithm 1 successfully." << std::endl;
+    arena.report("Algorithm 1 memory");
 }
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "algorithm.h"
+#include "TSPLIB.h"
+#include "Partition.h"
+#include "Timing.h"
+#include <iostream>
+#include <chrono>
+
+static const int compareLimit = 10000; // Largest instance also solved unpartitioned for comparison
+
+template <class Metric>
+static void solvePartitioned(const TSPLIBInstance& instance, const PartitionOptions& options, const std::string& outputFile) {
+    std::vector<std::pair<double, double>> points = prepareCoordinates<Metric>(instance.coords);
+    CoordinateDistance<Metric> dist(points);
+    int n = instance.dimension;
+
+    auto start = std::chrono::steady_clock::now();
+    PartitionStats stats;
+    std::vector<int> tour = partitionedTour<Metric>(points, options, stats);
+    double totalMs = elapsedMs(start);
+    writeCycle(tour, dist, n, outputFile);
+
+    std::cout << stats.tiles << " tiles: partition " << stats.partitionMs << " ms, solve " << stats.solveMs
+              << " ms, stitch " << stats.stitchMs << " ms, smooth " << stats.smoothMs << " ms ("
+              << n / (totalMs / 1000.0) << " cities/s)." << std::endl;
+    std::cout << "Tour length " << stats.length << " (" << stats.stitchedLength << " before smoothing)." << std::endl;
+
+    if (n <= compareLimit) {
+        start = std::chrono::steady_clock::now();
+        ConstructionResult global = constructTour(dist, options.starts);
+        double globalMs = elapsedMs(start);
+        std::cout << "Unpartitioned: length " << global.length << " in " << globalMs << " ms; partitioned gap "
+                  << (stats.length / global.length - 1) * 100 << "%, speedup " << globalMs / totalMs << "x." << std::endl;
+    }
+}
+
+void runAlgorithm10(const std::string& inputFile, const std::string& outputFile, int tileSize, int smoothWindow) {
+    TSPLIBInstance instance = readInstance(inputFile);
+    if (instance.type == EdgeWeightType::Explicit) {
+        std::cerr << "The partitioned mode needs city coordinates, not EXPLICIT weights." << std::endl;
+        exit(102);
+    }
+    PartitionOptions options;
+    options.tileSize = tileSize;
+    options.smoothWindow = smoothWindow;
+
+    switch (instance.type) {
+    case EdgeWeightType::Euc2D: solvePartitioned<Euc2D>(instance, options, outputFile); break;
+    case EdgeWeightType::Ceil2D: solvePartitioned<Ceil2D>(instance, options, outputFile); break;
+    case EdgeWeightType::Geo: solvePartitioned<Geo>(instance, options, outputFile); break;
+    case EdgeWeightType::Att: solvePartitioned<Att>(instance, options, outputFile); break;
+    default: solvePartitioned<Euclidean>(instance, options, outputFile); break;
+    }
+    std::cout << "Hamiltonian cycle generated by algorithm 10 successfully." << std::endl;
+}
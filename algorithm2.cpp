@@ -1,9 +1,21 @@
 #include "algorithm.h"
+#include "ExternalMST.h"
 #include <fstream>
 #include <iostream>
 
-void runAlgorithm2(const std::string& inputFilePath, const std::string& outputFilePath) {
-    Graph g = create_graph(inputFilePath);
-    g.kruskalMST(outputFilePath);
+void kruskalMSTStage(const std::string& inputFile, const std::string& outputFile, std::pmr::memory_resource* mr) {
+    Graph g = create_graph(inputFile, mr);
+    g.kruskalMST(outputFile);
+}
+
+void runAlgorithm2(const std::string& inputFilePath, const std::string& outputFilePath, double memoryBudgetMB) {
+    if (memoryBudgetMB > 0) { // Out-of-core mode for edge files larger than memory
+        externalKruskalMST(inputFilePath, outputFilePath, static_cast<std::size_t>(memoryBudgetMB * 1024 * 1024));
+        std::cout << "MST generated by algorithm 2 successfully." << std::endl;
+        return;
+    }
+    RunArena arena;
+    kruskalMSTStage(inputFilePath, outputFilePath, arena.resource());
     std::cout << "MST generated by algorithm 2 successfully." << std::endl;
+    arena.report("Algorithm 2 memory");
 }
\ No newline at end of file
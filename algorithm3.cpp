@@ -3,7 +3,9 @@
 #include <iostream>
 
 void runAlgorithm3(const std::string& inputFilePath, const std::string& outputFilePath) {
-    Graph g = create_graph(inputFilePath);
+    RunArena arena;
+    Graph g = create_graph(inputFilePath, arena.resource());
     g.primMST(outputFilePath);
     std::cout << "MST generated by algorithm 3 successfully." << std::endl;
+    arena.report("Algorithm 3 memory");
 }
\ No newline at end of file
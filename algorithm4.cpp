@@ -2,8 +2,10 @@
 #include <fstream>
 #include <iostream>
 
-void runAlgorithm4(const std::string& inputFilePath, const std::string& outputFilePath) {
-    Graph g = create_graph(inputFilePath);
-    g.constructHamiltonianCycle(outputFilePath);
+void runAlgorithm4(const std::string& inputFilePath, const std::string& outputFilePath, int starts, int randomizedRuns) {
+    RunArena arena;
+    Graph g = create_graph(inputFilePath, arena.resource());
+    g.constructHamiltonianCycle(outputFilePath, starts, randomizedRuns);
     std::cout << "Hamiltonian cycle generated by algorithm 4 successfully." << std::endl;
+    arena.report("Algorithm 4 memory");
 }
\ No newline at end of file
@@ -4,18 +4,20 @@
 
 void runAlgorithm5(const std::string& inputFile, const std::string& outputFile) {
     std::string basePath = getExecutablePath();
+    RunArena arena; // Shared by every stage, so the report covers the whole pipeline
     // Generate MST and duplicate its edges
-    runAlgorithm2(inputFile, basePath + "\\mst");
-    Graph g = create_graph(basePath + "\\mst");
+    kruskalMSTStage(inputFile, basePath + "\\mst", arena.resource());
+    Graph g = create_graph(basePath + "\\mst", arena.resource());
     g.duplicateEdgesInMST(basePath + "\\mst", basePath + "\\duplicated_mst");
 
     // Generate Eulerian tour from the doubled MST
-    runAlgorithm1(basePath + "\\duplicated_mst", basePath + "\\eulerian_tour");
+    eulerTourStage(basePath + "\\duplicated_mst", basePath + "\\eulerian_tour", arena.resource());
 
     // Convert Eulerian tour to Hamiltonian cycle
-    g = create_graph(inputFile);
-    Graph e = create_graph(basePath + "\\eulerian_tour");
+    g = create_graph(inputFile, arena.resource());
+    Graph e = create_graph(basePath + "\\eulerian_tour", arena.resource());
     e.convertToHamiltonianCycle(g, outputFile);
 
     std::cout << "Hamiltonian cycle generated by algorithm 5 successfully." << std::endl;
+    arena.report("Algorithm 5 memory");
 }
\ No newline at end of file
@@ -2,9 +2,9 @@
 #include <fstream>
 #include <iostream>
 
-void combineMSTAndMWPM(const std::string& mstPath, const std::string& mwpmPath, const std::string& combinedPath, std::unordered_map<int, int>& inverseMap) {
-    Graph mstGraph = create_graph(mstPath);
-    Graph mwpmGraph = create_graph(mwpmPath);
+void combineMSTAndMWPM(const std::string& mstPath, const std::string& mwpmPath, const std::string& combinedPath, std::unordered_map<int, int>& inverseMap, std::pmr::memory_resource* mr) {
+    Graph mstGraph = create_graph(mstPath, mr);
+    Graph mwpmGraph = create_graph(mwpmPath, mr);
 
     // Apply inverse mapping to MWPM edges only
     for (auto& edge : mwpmGraph.edges) {
@@ -20,12 +20,13 @@ void combineMSTAndMWPM(const std::string& mstPath, const std::string& mwpmPath,
 
 void runAlgorithm6(const std::string& inputFile, const std::string& outputFile) {
     std::string basePath = getExecutablePath();
+    RunArena arena; // Shared by every stage, so the report covers the whole pipeline
 
     // Execute MST computation (e.g., with Algorithm 2 or 3)
-    runAlgorithm2(inputFile, basePath + "\\mst");
+    kruskalMSTStage(inputFile, basePath + "\\mst", arena.resource());
 
     // Find odd degree vertices in MST
-    Graph g = create_graph(basePath + "\\mst");
+    Graph g = create_graph(basePath + "\\mst", arena.resource());
     std::vector<int> oddVertices = g.findOddDegreeVertices();
 
     // Prepare input for MWPM and compute MWPM
@@ -33,7 +34,7 @@ void runAlgorithm6(const std::string& inputFile, const std::string& outputFile)
     for (int i = 0; i < oddVertices.size(); ++i) {
         vertexMap[oddVertices[i]] = i;
     }
-    g = create_graph(inputFile);
+    g = create_graph(inputFile, arena.resource());
     g.prepareMWPMInput(oddVertices, basePath + "\\mwpm_input", vertexMap);
     std::string blossomPath = readToolPath();
     std::string cmdMWPM = blossomPath + "/blossom4 -e " + basePath + "\\mwpm_input -w " + basePath + "\\mwpm_output";
@@ -44,15 +45,16 @@ void runAlgorithm6(const std::string& inputFile, const std::string& outputFile)
     for (const auto& pair : vertexMap) {
         inverseMap[pair.second] = pair.first;  // Create inverse mapping
     }
-    combineMSTAndMWPM(basePath + "\\mst", basePath + "\\mwpm_output", basePath + "\\combined_graph", inverseMap);
+    combineMSTAndMWPM(basePath + "\\mst", basePath + "\\mwpm_output", basePath + "\\combined_graph", inverseMap, arena.resource());
 
     // Generate Eulerian tour from combined graph
-    runAlgorithm1(basePath + "\\combined_graph", basePath + "\\eulerian_tour");
+    eulerTourStage(basePath + "\\combined_graph", basePath + "\\eulerian_tour", arena.resource());
 
     // Convert Eulerian tour to Hamiltonian cycle
-    g = create_graph(inputFile);
-    Graph e = create_graph(basePath + "\\eulerian_tour");
+    g = create_graph(inputFile, arena.resource());
+    Graph e = create_graph(basePath + "\\eulerian_tour", arena.resource());
     e.convertToHamiltonianCycle(g, outputFile);
 
     std::cout << "Hamiltonian cycle generated by algorithm 6 successfully." << std::endl;
+    arena.report("Algorithm 6 memory");
 }
\ No newline at end of file
@@ -1,30 +1,68 @@
-#include "Algorithm.h"
+#include "algorithm.h"
+#include "Reads.h"
 #include <fstream>
 #include <iostream>
 #include <sstream>
 
-int verticesCount;
-std::unordered_map<std::string, int> stringToIndex;
-std::unordered_map<int, std::string> indexToString;
+// Read one string per line into the store, ignoring blank lines and surrounding whitespace
+template <class Reads>
+bool readStringsFromFile(const std::string& filePath, Reads& reads) {
+    std::ifstream inFile(filePath);
+    std::string line;
+    while (std::getline(inFile, line)) {
+        // Use a stringstream to trim whitespace and tabs from the line
+        std::istringstream iss(line);
+        std::string trimmedString;
+        iss >> trimmedString; // This reads the first token, ignoring leading whitespace
+        if (!trimmedString.empty() && !reads.append(trimmedString)) {
+            std::cerr << "Not a nucleotide read: " << trimmedString << std::endl;
+            return false;
+        }
+    }
+    reads.removeDuplicates();
+    return true;
+}
 
-int calculateOverlap(const std::string& a, const std::string& b) {
-    int maxOverlap = 0;
-    for (int i = 1; i <= std::min(a.size(), b.size()); ++i) {
-        if (a.substr(a.size() - i) == b.substr(0, i)) {
-            maxOverlap = i;
+// Write the distance graph and its bipartite version without materialising a Graph.
+// Vertex 0 is the empty string; the weight of s1 -> s2 is |s1| - overlap(s1, s2).
+template <class Reads>
+void saveDistanceGraphs(const Reads& reads, const std::string& distancePath, const std::string& bipartitePath) {
+    std::ofstream distanceFile(distancePath);
+    std::ofstream bipartiteFile(bipartitePath);
+    int V = reads.size();
+    long long E = static_cast<long long>(V - 1) * V;
+
+    distanceFile << V << " " << E << "\n";
+    // Output the vertices count (doubled) and edges count to the file
+    bipartiteFile << V * 2 << " " << E << std::endl;
+
+    auto writeEdge = [&](int from, int to, float weight) {
+        distanceFile << from << " " << to << " " << weight << "\n";
+        // Offset the second copy of the vertices so the two sides are disjoint
+        bipartiteFile << from << " " << to + V << " " << weight << "\n";
+    };
+    for (int from = 1; from < V; ++from) {
+        for (int to = 1; to < V; ++to) {
+            if (from != to) {
+                float weight = static_cast<float>(reads.length(from) - reads.overlap(from, to));
+                writeEdge(from, to, weight);
+            }
         }
+        // Handle edges to and from the empty string (vertex 0)
+        writeEdge(0, from, 0); // From empty string to s1
+        writeEdge(from, 0, static_cast<float>(reads.length(from))); // From s1 to empty string
     }
-    return maxOverlap;
 }
 
-std::vector<std::pair<std::string, std::string>> parseMatchingOutput(const std::string& matchingOutputPath) {
+// Parse the matching as successor ids: next[u] = v for each matched pair, -1 if unmatched
+std::vector<int> parseMatchingOutput(const std::string& matchingOutputPath, int verticesCount) {
     std::ifstream inFile(matchingOutputPath);
-    std::vector<std::pair<std::string, std::string>> matchedPairs;
+    std::vector<int> next(verticesCount, -1);
     std::string line;
 
     if (!inFile.is_open()) {
         std::cerr << "Failed to open file: " << matchingOutputPath << std::endl;
-        return matchedPairs;
+        return next;
     }
 
     // Skip the first line containing metadata about the number of vertices and edges
@@ -35,142 +73,78 @@ std::vector<std::pair<std::string, std::string>> parseMatchingOutput(const std::
         std::istringstream lineStream(line);
         int u, v, w;
         if (lineStream >> u >> v >> w) {
-            // Convert integer vertices back to their original string format
-            std::string uStr = indexToString.at(u);
-            std::string vStr = indexToString.at(v - verticesCount);
-            matchedPairs.emplace_back(uStr, vStr);
+            if (u >= verticesCount) std::swap(u, v); // The pair may list the second side first
+            if (u < 0 || u >= verticesCount || v < verticesCount || v >= 2 * verticesCount) {
+                std::cerr << "Invalid matching edge in " << matchingOutputPath << ": " << line << std::endl;
+                exit(102);
+            }
+            next[u] = v - verticesCount; // Undo the offset of the second side
         }
     }
-    return matchedPairs;
+    return next;
 }
 
-std::string concatenateFromMatchedPairs(const std::vector<std::pair<std::string, std::string>>& matchedPairs) {
-    if (matchedPairs.empty()) return "";
-
-    // Build the sequence map from matched pairs and track unvisited vertices
-    std::unordered_map<std::string, std::string> nextInSequence;
-    std::unordered_set<std::string> unvisitedVertices;
-    for (const auto& pair : matchedPairs) {
-        nextInSequence[pair.first] = pair.second;
-        unvisitedVertices.insert(pair.first);
-    }
-
+// Follow the cycles of the matching, appending each read minus its overlap with the next one
+template <class Reads>
+std::string concatenateFromMatching(const Reads& reads, const std::vector<int>& next) {
     std::string result = "";
+    std::vector<char> visited(next.size(), 0);
 
-    // Iterate until there are no unvisited vertices left
-    while (!unvisitedVertices.empty()) {
-        // Start with an arbitrary unvisited vertex
-        std::string current = *unvisitedVertices.begin();
-        std::string cycleStart = current;
-        std::string cycle = current; // Initialize cycle with the starting string
+    for (int cycleStart = 0; cycleStart < static_cast<int>(next.size()); ++cycleStart) {
+        if (visited[cycleStart] || next[cycleStart] < 0) continue;
+        int current = cycleStart;
 
         // Follow the cycle
         while (true) {
-            unvisitedVertices.erase(current); // Mark current vertex as visited
-            const std::string& next = nextInSequence[current];
-
-            if (next == cycleStart) { //  || unvisitedVertices.find(next) == unvisitedVertices.end()
-                // Calculate overlap with the start of the cycle to close the cycle properly
-                int overlap = calculateOverlap(current, next);
-                result += current;
-                break; // Break if the cycle is complete or next vertex is already visited
+            visited[current] = 1; // Mark current vertex as visited
+            int following = next[current];
+
+            if (following == cycleStart || following < 0 || visited[following]) {
+                reads.appendPrefix(result, current, reads.length(current));
+                break; // Break if the cycle is complete
             }
 
-            // Calculate overlap and append the non-overlapping part of the next string
-            int overlap = calculateOverlap(current, next);
-            result += current.substr(0, current.size() - overlap);
+            // Append the non-overlapping part of the current read
+            int overlap = reads.overlap(current, following);
+            reads.appendPrefix(result, current, reads.length(current) - overlap);
 
-            current = next; // Move to the next vertex in the sequence
+            current = following; // Move to the next vertex in the sequence
         }
     }
 
     return result;
 }
 
-Graph constructDistanceGraph(const std::vector<std::string>& strings) {
-    int index = 1; // Start indexing from 1 to reserve 0 for the empty string
-    stringToIndex[""] = 0; // Map the empty string to 0
-    indexToString[0] = "";
-
-    for (const auto& s : strings) {
-        if (stringToIndex.find(s) == stringToIndex.end()) {
-            stringToIndex[s] = index;
-            indexToString[index] = s;
-            index++;
-        }
-    }
-
-    // Construct the graph using integer vertices
-    Graph g(strings.size() + 1, strings.size() * (strings.size() + 1));
-    for (const auto& s1 : strings) {
-        int from = stringToIndex[s1];
-        for (const auto& s2 : strings) {
-            if (s1 != s2) {
-                int to = stringToIndex[s2];
-                float weight = s1.size() - calculateOverlap(s1, s2);
-                g.addEdge(from, to, weight);
-            }
-        }
-        // Handle edges to and from the empty string (vertex 0)
-        g.addEdge(0, from, 0); // From empty string to s1
-        g.addEdge(from, 0, s1.length()); // From s1 to empty string
-    }
-    return g;
-}
-
-std::vector<std::string> readStringsFromFile(const std::string& filePath) {
-    std::ifstream inFile(filePath);
-    std::vector<std::string> strings;
-    std::string line;
-    while (std::getline(inFile, line)) {
-        // Use a stringstream to trim whitespace and tabs from the line
-        std::istringstream iss(line);
-        std::string trimmedString;
-        iss >> trimmedString; // This reads the first token, ignoring leading whitespace
-        if (!trimmedString.empty()) {
-            strings.push_back(trimmedString);
-        }
-    }
-    return strings;
-}
-
-void saveBipartiteGraphToFile(const Graph& g, const std::string& filePath) {
-    std::ofstream outFile(filePath);
-
-    // Output the vertices count (doubled) and edges count to the file
-    outFile << g.V * 2 << " " << g.E << std::endl;
-
-    for (const auto& edge : g.edges) {
-        // For a bipartite graph constructed from an integer-based graph,
-        // we can distinguish the two sets by adding an offset to one set
-        int from = std::get<1>(edge); // Offset for set X
-        int to = std::get<2>(edge) + g.V; // Offset for set Y, ensuring it's disjoint from X
-
-        outFile << from << " " << to << " " << std::get<0>(edge) << std::endl;
-    }
-}
-
-void runAlgorithm7(const std::string& inputFile, const std::string& outputFile) {
+template <class Reads>
+void solveSuperstring(const std::string& inputFile, const std::string& outputFile) {
     std::string basePath = getExecutablePath();
 
-    // Read strings and construct the distance graph
-    std::vector<std::string> strings = readStringsFromFile(inputFile);
-    Graph g = constructDistanceGraph(strings);
-    verticesCount = g.V;
-    g.saveGraphToFile(basePath + "\\distance_graph");
+    // Read strings and write the distance graph and its bipartite version
+    Reads reads;
+    if (!readStringsFromFile(inputFile, reads)) exit(102);
+    std::cout << reads.size() - 1 << " distinct reads stored in " << reads.memoryBytes() << " bytes." << std::endl;
+    saveDistanceGraphs(reads, basePath + "\\distance_graph", basePath + "\\bipartite_graph");
 
-    // Convert the graph to a bipartite graph and find the MWPM
-    saveBipartiteGraphToFile(g, basePath + "\\bipartite_graph");
+    // Find the MWPM of the bipartite graph
     std::string blossomPath = readToolPath();
     std::string cmdMWPM = blossomPath + "/blossom4 -e " + basePath + "\\bipartite_graph -w " + basePath + "\\matching_output";
     system(cmdMWPM.c_str());
 
     // Parse the MWPM output and concatenate strings
-    std::vector<std::pair<std::string, std::string>> matchedPairs = parseMatchingOutput(basePath + "\\matching_output");
-    std::string concatenatedString = concatenateFromMatchedPairs(matchedPairs);
+    std::vector<int> next = parseMatchingOutput(basePath + "\\matching_output", reads.size());
+    std::string concatenatedString = concatenateFromMatching(reads, next);
 
     // Write the concatenated (super)string to the output file
     std::ofstream outFile(outputFile);
     outFile << concatenatedString;
+}
+
+void runAlgorithm7(const std::string& inputFile, const std::string& outputFile, bool nucleotides) {
+    if (nucleotides) {
+        solveSuperstring<PackedReads>(inputFile, outputFile); // 2-bit packed A/C/G/T reads
+    }
+    else {
+        solveSuperstring<StringReads>(inputFile, outputFile);
+    }
     std::cout << "Superstring generated by algorthm 7 successfully." << std::endl;
-}
\ No newline at end of file
+}
@@ -0,0 +1,77 @@
+#include "algorithm.h"
+#include "Incremental.h"
+#include "Timing.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <chrono>
+
+struct UpdateTimes {
+    int count = 0;
+    double total = 0, max = 0;
+    void record(double ms) {
+        count++;
+        total += ms;
+        max = std::max(max, ms);
+    }
+    double mean() const { return count ? total / count : 0; }
+};
+
+void runAlgorithm8(const std::string& inputFile, const std::string& outputFile, const std::string& updatesFile) {
+    std::ifstream updates(updatesFile);
+    if (!updates) {
+        std::cerr << "Cannot open updates file" << updatesFile << std::endl;
+        exit(101);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    IncrementalTour tour(readCoordinates(inputFile));
+    double buildTime = elapsedMs(start);
+
+    // Apply "add x y" and "remove id" updates one at a time, timing each repair.
+    // Additions and removals are timed separately since removals scan more of the instance.
+    std::string line;
+    UpdateTimes adds, removes;
+    while (std::getline(updates, line)) {
+        std::istringstream iss(line);
+        std::string op;
+        if (!(iss >> op)) continue;
+
+        start = std::chrono::steady_clock::now();
+        if (op == "add") {
+            float x, y;
+            if (!(iss >> x >> y)) {
+                std::cerr << "Error processing update: " << line << std::endl;
+                exit(102);
+            }
+            tour.addVertex(x, y);
+            adds.record(elapsedMs(start));
+        }
+        else if (op == "remove") {
+            int id;
+            if (!(iss >> id) || !tour.removeVertex(id)) {
+                std::cerr << "Error processing update: " << line << std::endl;
+                exit(102);
+            }
+            removes.record(elapsedMs(start));
+        }
+        else {
+            std::cerr << "Unknown update: " << line << std::endl;
+            exit(102);
+        }
+    }
+    tour.saveTour(outputFile);
+
+    // Full recompute of the final instance for comparison
+    std::vector<std::pair<float, float>> finalPoints = tour.alivePoints();
+    start = std::chrono::steady_clock::now();
+    IncrementalTour reference(finalPoints);
+    double recomputeTime = elapsedMs(start);
+
+    std::cout << "Incremental tour: initial build " << buildTime << " ms; full recompute " << recomputeTime << " ms." << std::endl;
+    std::cout << adds.count << " additions: mean " << adds.mean() << " ms, max " << adds.max << " ms; "
+              << removes.count << " removals: mean " << removes.mean() << " ms, max " << removes.max << " ms." << std::endl;
+    std::cout << "Tour length " << tour.tourLength() << " for " << tour.size() << " cities (full recompute "
+              << reference.tourLength() << ", MST " << tour.mstWeight() << ", " << tour.rebuilds()
+              << " tour rebuilds)." << std::endl;
+}
@@ -0,0 +1,35 @@
+#include "algorithm.h"
+#include "TSPLIB.h"
+#include "Tour.h"
+#include <iostream>
+
+template <class Distance>
+static void solveTour(const Distance& dist, int starts, const std::string& outputFile) {
+    ConstructionResult result = constructTour(dist, starts);
+    writeCycle(result.tour, dist, dist.size(), outputFile);
+    std::cout << "MST " << result.mstWeight << ", double tree " << result.doubleTree << ", nearest neighbor "
+              << result.nearest << ", after 2-opt " << result.length << "." << std::endl;
+}
+
+template <class Metric>
+static void solveCoordinates(const TSPLIBInstance& instance, int starts, const std::string& outputFile) {
+    std::vector<std::pair<double, double>> points = prepareCoordinates<Metric>(instance.coords);
+    solveTour(CoordinateDistance<Metric>(points), starts, outputFile);
+}
+
+void runAlgorithm9(const std::string& inputFile, const std::string& outputFile, int starts) {
+    TSPLIBInstance instance = readInstance(inputFile);
+    std::cout << "Instance " << instance.name << ": " << instance.dimension << " cities, "
+              << edgeWeightTypeName(instance.type) << " distances." << std::endl;
+
+    // The metric is chosen once here; constructTour is compiled separately for each metric
+    switch (instance.type) {
+    case EdgeWeightType::Euclidean: solveCoordinates<Euclidean>(instance, starts, outputFile); break;
+    case EdgeWeightType::Euc2D: solveCoordinates<Euc2D>(instance, starts, outputFile); break;
+    case EdgeWeightType::Ceil2D: solveCoordinates<Ceil2D>(instance, starts, outputFile); break;
+    case EdgeWeightType::Geo: solveCoordinates<Geo>(instance, starts, outputFile); break;
+    case EdgeWeightType::Att: solveCoordinates<Att>(instance, starts, outputFile); break;
+    case EdgeWeightType::Explicit: solveTour(ExplicitDistance(instance), starts, outputFile); break;
+    }
+    std::cout << "Hamiltonian cycle generated by algorithm 9 successfully." << std::endl;
+}
@@ -0,0 +1,137 @@
+#include "algorithm.h"
+#include "TSPLIB.h"
+#include "Tour.h"
+#include "Timing.h"
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <chrono>
+
+// Run-time dispatched alternatives to CoordinateDistance<Metric>, used only as benchmark baselines
+
+// Switch on the metric for every distance
+class SwitchDistance {
+public:
+    SwitchDistance(EdgeWeightType type, const std::vector<std::pair<double, double>>& points) : type(type), points(&points) {}
+    float operator()(int u, int v) const {
+        const auto& a = (*points)[u];
+        const auto& b = (*points)[v];
+        switch (type) {
+        case EdgeWeightType::Euc2D: return Euc2D::distance(a, b);
+        case EdgeWeightType::Ceil2D: return Ceil2D::distance(a, b);
+        case EdgeWeightType::Geo: return Geo::distance(a, b);
+        case EdgeWeightType::Att: return Att::distance(a, b);
+        default: return Euclidean::distance(a, b);
+        }
+    }
+    int size() const { return static_cast<int>(points->size()); }
+
+private:
+    EdgeWeightType type;
+    const std::vector<std::pair<double, double>>* points;
+};
+
+// Virtual call for every distance
+class MetricFunction {
+public:
+    virtual ~MetricFunction() = default;
+    virtual float distance(int u, int v) const = 0;
+};
+
+template <class Metric>
+class MetricFunctionImpl : public MetricFunction {
+public:
+    explicit MetricFunctionImpl(const std::vector<std::pair<double, double>>& points) : points(&points) {}
+    float distance(int u, int v) const override { return Metric::distance((*points)[u], (*points)[v]); }
+
+private:
+    const std::vector<std::pair<double, double>>* points;
+};
+
+static std::unique_ptr<MetricFunction> makeMetricFunction(EdgeWeightType type, const std::vector<std::pair<double, double>>& points) {
+    switch (type) {
+    case EdgeWeightType::Euc2D: return std::make_unique<MetricFunctionImpl<Euc2D>>(points);
+    case EdgeWeightType::Ceil2D: return std::make_unique<MetricFunctionImpl<Ceil2D>>(points);
+    case EdgeWeightType::Geo: return std::make_unique<MetricFunctionImpl<Geo>>(points);
+    case EdgeWeightType::Att: return std::make_unique<MetricFunctionImpl<Att>>(points);
+    default: return std::make_unique<MetricFunctionImpl<Euclidean>>(points);
+    }
+}
+
+class VirtualDistance {
+public:
+    VirtualDistance(const MetricFunction& metric, int n) : metric(&metric), n(n) {}
+    float operator()(int u, int v) const { return metric->distance(u, v); }
+    int size() const { return n; }
+
+private:
+    const MetricFunction* metric;
+    int n;
+};
+
+struct KernelTimes {
+    double prim = 0, nearest = 0, local = 0; // Milliseconds
+    double checksum = 0;                     // MST weight + tour lengths, must agree across variants
+};
+
+// Time the MST, nearest-neighbor and 2-opt kernels with one distance source (single-threaded)
+template <class Distance>
+static KernelTimes timeKernels(const Distance& dist) {
+    KernelTimes times;
+    auto start = std::chrono::steady_clock::now();
+
+    for (const auto& edge : primTree(dist)) times.checksum += std::get<0>(edge);
+    times.prim = elapsedMs(start);
+    MultiStartResult nearest = nearestNeighborMultiStart(dist, 1);
+    times.nearest = elapsedMs(start);
+    std::vector<int> tour = nearest.cycle;
+    double gain = twoOpt(tour, dist, {}, 10 * dist.size());
+    times.local = elapsedMs(start);
+    times.checksum += nearest.length - gain;
+    return times;
+}
+
+template <class Metric>
+static KernelTimes timeSpecialised(const std::vector<std::pair<double, double>>& points) {
+    return timeKernels(CoordinateDistance<Metric>(points));
+}
+
+void runMetricBenchmark(const std::string& inputFile, const std::string& outputFile) {
+    TSPLIBInstance instance = readInstance(inputFile);
+    if (instance.type == EdgeWeightType::Explicit) {
+        std::cerr << "The metric benchmark needs a coordinate instance, not EXPLICIT weights." << std::endl;
+        exit(102);
+    }
+
+    std::vector<std::pair<double, double>> points;
+    KernelTimes specialised;
+    switch (instance.type) {
+    case EdgeWeightType::Euc2D: points = prepareCoordinates<Euc2D>(instance.coords); specialised = timeSpecialised<Euc2D>(points); break;
+    case EdgeWeightType::Ceil2D: points = prepareCoordinates<Ceil2D>(instance.coords); specialised = timeSpecialised<Ceil2D>(points); break;
+    case EdgeWeightType::Geo: points = prepareCoordinates<Geo>(instance.coords); specialised = timeSpecialised<Geo>(points); break;
+    case EdgeWeightType::Att: points = prepareCoordinates<Att>(instance.coords); specialised = timeSpecialised<Att>(points); break;
+    default: points = instance.coords; specialised = timeSpecialised<Euclidean>(points); break;
+    }
+    KernelTimes switched = timeKernels(SwitchDistance(instance.type, points));
+    std::unique_ptr<MetricFunction> metric = makeMetricFunction(instance.type, points);
+    KernelTimes dispatched = timeKernels(VirtualDistance(*metric, instance.dimension));
+
+    std::ofstream outFile(outputFile);
+    for (std::ostream* out : { static_cast<std::ostream*>(&std::cout), static_cast<std::ostream*>(&outFile) }) {
+        *out << "Metric benchmark: " << instance.dimension << " cities, " << edgeWeightTypeName(instance.type) << std::endl;
+        *out << std::fixed << std::setprecision(2);
+        *out << "kernel         template_ms  switch_ms  virtual_ms  speedup_vs_switch  speedup_vs_virtual" << std::endl;
+        auto row = [&](const char* name, double t, double s, double v) {
+            *out << std::left << std::setw(15) << name << std::right << std::setw(11) << t << std::setw(11) << s
+                 << std::setw(12) << v << std::setw(19) << s / t << std::setw(20) << v / t << std::endl;
+        };
+        row("prim_mst", specialised.prim, switched.prim, dispatched.prim);
+        row("nearest", specialised.nearest, switched.nearest, dispatched.nearest);
+        row("two_opt", specialised.local, switched.local, dispatched.local);
+        *out << std::defaultfloat;
+        if (specialised.checksum != switched.checksum || specialised.checksum != dispatched.checksum) {
+            *out << "Warning: results differ between variants." << std::endl;
+        }
+    }
+}